@@ -0,0 +1,80 @@
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include "system/lwow_reactor_epoll.h"
+
+/*
+ * Reactor bus on pseudo-terminal, without any hardware.
+ * Application plays 1-Wire network on master side of the pty:
+ * every UART byte is echoed back, reset byte is answered with presence pulse.
+ * Network therefore has single device, which always reads as logical `1`
+ */
+static void
+pty_serve(int mfd) {
+    uint8_t b[64];
+    ssize_t len;
+
+    while ((len = read(mfd, b, sizeof(b))) > 0) {
+        for (ssize_t i = 0; i < len; ++i) {
+            if (b[i] == 0xF0) {
+                b[i] = 0xE0; /* Presence pulse */
+            }
+        }
+        write(mfd, b, (size_t)len);
+    }
+}
+
+static void
+txn_done(lwow_reactor_bus_t* bus, lwow_txn_t* txn, lwowr_t res, void* arg) {
+    LWOW_UNUSED(bus);
+    LWOW_UNUSED(txn);
+    *(lwowr_t*)arg = res;
+}
+
+int
+main(void) {
+    lwow_reactor_t r;
+    lwow_reactor_bus_t bus;
+    lwow_txn_t txn;
+    struct termios tio;
+    uint8_t data[2];
+    lwowr_t res = lwowERR;
+    size_t pending;
+    int mfd;
+
+    /* Open master side in raw non-blocking mode */
+    mfd = posix_openpt(O_RDWR | O_NOCTTY);
+    grantpt(mfd);
+    unlockpt(mfd);
+    tcgetattr(mfd, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(mfd, TCSANOW, &tio);
+    fcntl(mfd, F_SETFL, fcntl(mfd, F_GETFL) | O_NONBLOCK);
+
+    /* Slave side is used as serial port of the bus */
+    lwow_reactor_init(&r, 100);
+    if (lwow_reactor_open_bus(&r, &bus, ptsname(mfd)) != lwowOK) {
+        return -1;
+    }
+
+    /* Reset, skip ROM and read 2 bytes */
+    lwow_txn_init(&txn);
+    lwow_txn_add_reset(&txn);
+    lwow_txn_add_select(&txn, NULL);
+    lwow_txn_add_read(&txn, data, sizeof(data));
+    lwow_reactor_submit(&r, &bus, &txn, txn_done, &res);
+    do {
+        pty_serve(mfd);
+        lwow_reactor_run(&r, 10, &pending);
+    } while (pending > 0);
+    printf("Result: %d, data: %02X %02X\r\n", (int)res, (unsigned)data[0], (unsigned)data[1]);
+
+    lwow_reactor_remove_bus(&r, &bus);
+    close(bus.fd);
+    close(mfd);
+    lwow_reactor_deinit(&r);
+    return 0;
+}
@@ -18,6 +18,8 @@ set(LWOW_CUSTOM_INC_DIR ${CMAKE_CURRENT_BINARY_DIR}/lib_inc)
 # Library core sources
 set(lwow_core_SRCS
     ${CMAKE_CURRENT_LIST_DIR}/src/lwow/lwow.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwow/lwow_registry.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/lwow/lwow_group.c
 )
 
 # Add system port
@@ -31,6 +33,7 @@ endif()
 # Devices
 set(lwow_devices_SRCS
     ${CMAKE_CURRENT_LIST_DIR}/src/devices/lwow_device_ds18x20.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/devices/lwow_device_ds18x20_sampler.c
 )
 
 # Setup include directories
@@ -34,12 +34,197 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "lwow/devices/lwow_device_ds18x20.h"
 #include "lwow/lwow.h"
 
+#if LWOW_CFG_DS18X20_POLL_DELAY
+#if !LWOW_CFG_OS
+#error "LWOW_CFG_OS must be enabled when LWOW_CFG_DS18X20_POLL_DELAY is non-zero"
+#endif /* !LWOW_CFG_OS */
+#include "system/lwow_sys.h"
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY */
+
 #define LWOW_DS18B20_FAMILY_CODE 0x28U
 #define LWOW_DS18S20_FAMILY_CODE 0x10U
 
+/* Maximum EEPROM write time in units of milliseconds */
+#define LWOW_DS18X20_EEPROM_WRITE_TIME 10U
+
+/* Approximate duration of single read time slot in units of microseconds */
+#define LWOW_DS18X20_SLOT_TIME_STD 87U
+#define LWOW_DS18X20_SLOT_TIME_OD  ((10000000UL + LWOW_CFG_OD_BAUD_DATA - 1U) / LWOW_CFG_OD_BAUD_DATA)
+
+/* Maximum number of devices configured with single copy to EEPROM, when alarm values are preserved */
+#define LWOW_DS18X20_PRESERVE_CHUNK 32U
+
+#if LWOW_CFG_DEV_CACHE_SIZE
+
+/* Device cache entry flags */
+#define LWOW_DS18X20_CACHE_SCRATCHPAD 0x01U /* Alarm and configuration registers are valid */
+#define LWOW_DS18X20_CACHE_POWER      0x02U /* Power supply mode is valid */
+#define LWOW_DS18X20_CACHE_PARASITE   0x04U /* Device is in parasite power mode */
+#define LWOW_DS18X20_CACHE_SYNCED     0x08U /* Scratchpad configuration is known to match EEPROM */
+
+/**
+ * \brief           Find cache entry for device
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address. `NULL` is never cached
+ * \param[in]       create: Set to `1` to allocate new entry, if device is not in the cache yet
+ * \return          Pointer to cache entry, `NULL` if not found
+ */
+static lwow_dev_cache_t*
+prv_cache_get(lwow_t* const owobj, const lwow_rom_t* const rom_id, uint8_t create) {
+    lwow_dev_cache_t* entry = NULL;
+
+    if (rom_id == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < LWOW_ARRAYSIZE(owobj->dev_cache); ++i) {
+        if (owobj->dev_cache[i].flags != 0) {
+            if (LWOW_MEMCMP(&owobj->dev_cache[i].rom, rom_id, sizeof(*rom_id)) == 0) {
+                return &owobj->dev_cache[i];
+            }
+        } else if (entry == NULL) {
+            entry = &owobj->dev_cache[i];
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+
+    /* Replace entries in round-robin order when cache is full */
+    if (entry == NULL) {
+        entry = &owobj->dev_cache[owobj->dev_cache_next];
+        owobj->dev_cache_next = (owobj->dev_cache_next + 1U) % LWOW_ARRAYSIZE(owobj->dev_cache);
+    }
+    LWOW_MEMCPY(&entry->rom, rom_id, sizeof(*rom_id));
+    entry->flags = 0;
+    return entry;
+}
+
+/**
+ * \brief           Store alarm and configuration registers from CRC-verified scratchpad to the cache
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \param[in]       data: Scratchpad content
+ */
+static void
+prv_cache_store(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t* const data) {
+    lwow_dev_cache_t* entry = prv_cache_get(owobj, rom_id, 1);
+
+    if (entry != NULL) {
+        LWOW_MEMCPY(entry->data, &data[2], sizeof(entry->data)); /* TH, TL and configuration registers */
+        entry->flags |= LWOW_DS18X20_CACHE_SCRATCHPAD;
+    }
+}
+
+/**
+ * \brief           Invalidate cached alarm and configuration registers
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address. Set to `NULL` to invalidate all devices
+ */
+static void
+prv_cache_invalidate(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    for (size_t i = 0; i < LWOW_ARRAYSIZE(owobj->dev_cache); ++i) {
+        lwow_dev_cache_t* entry = &owobj->dev_cache[i];
+
+        if (rom_id == NULL || LWOW_MEMCMP(&entry->rom, rom_id, sizeof(*rom_id)) == 0) {
+            entry->flags &= ~LWOW_DS18X20_CACHE_SCRATCHPAD;
+        }
+    }
+}
+
+/**
+ * \brief           Mark scratchpad configuration as matching EEPROM or not
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address. Set to `NULL` to mark all cached devices
+ * \param[in]       synced: Set to `1` after copy or recall, `0` after scratchpad-only write
+ */
+static void
+prv_cache_set_synced(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t synced) {
+    lwow_dev_cache_t* entry;
+
+    if (rom_id != NULL && synced && (entry = prv_cache_get(owobj, rom_id, 1)) != NULL) {
+        entry->flags |= LWOW_DS18X20_CACHE_SYNCED;
+        return;
+    }
+    for (size_t i = 0; i < LWOW_ARRAYSIZE(owobj->dev_cache); ++i) {
+        entry = &owobj->dev_cache[i];
+        if (entry->flags != 0 && (rom_id == NULL || LWOW_MEMCMP(&entry->rom, rom_id, sizeof(*rom_id)) == 0)) {
+            if (synced) {
+                entry->flags |= LWOW_DS18X20_CACHE_SYNCED;
+            } else {
+                entry->flags &= ~LWOW_DS18X20_CACHE_SYNCED;
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Check if scratchpad configuration of device is known to match EEPROM
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address. `NULL` is never known
+ * \return          `1` if synced, `0` if unknown or not synced
+ */
+static uint8_t
+prv_cache_is_synced(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    lwow_dev_cache_t* entry = prv_cache_get(owobj, rom_id, 0);
+
+    return entry != NULL && (entry->flags & LWOW_DS18X20_CACHE_SYNCED) != 0;
+}
+
+#else
+#define prv_cache_store(owobj, rom_id, data)
+#define prv_cache_invalidate(owobj, rom_id)
+#define prv_cache_set_synced(owobj, rom_id, synced)
+#define prv_cache_is_synced(owobj, rom_id) 0
+#endif /* LWOW_CFG_DEV_CACHE_SIZE */
+
+/**
+ * \brief           Get alarm and configuration registers of device
+ *
+ * When \ref LWOW_CFG_DEV_CACHE_SIZE is enabled, registers are taken from the cache, if available.
+ * Otherwise complete scratchpad is read, checked for CRC and stored to the cache
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \param[out]      cfg: Output array to write `TH`, `TL` and configuration registers to
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+prv_get_config(lwow_t* const owobj, const lwow_rom_t* const rom_id, uint8_t* const cfg) {
+    uint8_t buff[10], len = 6;
+
+#if LWOW_CFG_DEV_CACHE_SIZE
+    lwow_dev_cache_t* entry = prv_cache_get(owobj, rom_id, 0);
+
+    if (entry != NULL && (entry->flags & LWOW_DS18X20_CACHE_SCRATCHPAD)) {
+        LWOW_MEMCPY(cfg, entry->data, sizeof(entry->data));
+        return 1;
+    }
+    if (rom_id != NULL) {
+        len = sizeof(buff); /* Complete scratchpad is needed to verify CRC before caching */
+    }
+#endif /* LWOW_CFG_DEV_CACHE_SIZE */
+
+    if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
+        /* Send command and read first 5 bytes (or complete scratchpad), configuration byte being the 5th one */
+        LWOW_MEMSET(buff, 0xFF, len);
+        buff[0] = LWOW_CMD_RSCRATCHPAD;
+        lwow_write_bytes_ex_raw(owobj, buff, buff, len);
+        if (len == sizeof(buff)) {
+            if (lwow_crc(&buff[1], sizeof(buff) - 1U) != 0) {
+                return 0;
+            }
+            prv_cache_store(owobj, rom_id, &buff[1]);
+        }
+        LWOW_MEMCPY(cfg, &buff[3], 3);
+        return 1;
+    }
+    return 0;
+}
+
 /**
  * \brief           Start temperature conversion on specific (or all) devices
  * \param[in]       ow: 1-Wire handle
@@ -70,32 +255,229 @@ lwow_ds18x20_start(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
 
     LWOW_ASSERT0("owobj != NULL", owobj != NULL);
 
-    lwow_protect(owobj, 1);
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
     res = lwow_ds18x20_start_raw(owobj, rom_id);
     lwow_unprotect(owobj, 1);
     return res;
 }
 
 /**
- * \brief           Read temperature previously started with \ref lwow_ds18x20_start
- * \param[in]       ow: 1-Wire handle
- * \param[in]       rom_id: 1-Wire device address to read data from
- * \param[out]      temp_out: Pointer to output float variable to save temperature
- * \return          `1` on success, `0` otherwise
+ * \brief           Check if temperature conversion is completed
+ *
+ * Function issues single read time slot, to which devices respond with `0`
+ * while conversion is in progress. It must be called after \ref lwow_ds18x20_start_raw,
+ * with no other communication on the bus in-between.
+ *
+ * \note            Works only with externally powered devices.
+ *                      Devices in parasite power mode need strong pull-up during conversion
+ *                      and must be given full conversion time instead
+ * \param[in]       owobj: 1-Wire handle
+ * \return          `1` if conversion completed on all started devices, `0` otherwise
  */
 uint8_t
-lwow_ds18x20_read_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, float* const temp_out) {
-    float dec = 0.0f;
-    uint16_t temp = 0;
-    uint8_t ret = 0, data[9] = {0}, crc = 0, resolution = 0, m = 0, bit_val = 0;
-    int8_t digit = 0;
+lwow_ds18x20_is_done_raw(lwow_t* const owobj) {
+    uint8_t bit_val = 0;
 
     LWOW_ASSERT0("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT0("temp_out != NULL", temp_out != NULL);
+
+    return lwow_read_bit_ex_raw(owobj, &bit_val) == lwowOK && bit_val != 0;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_is_done_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_is_done(lwow_t* const owobj) {
+    uint8_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_is_done_raw(owobj);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+/**
+ * \brief           Wait for temperature conversion to complete
+ *
+ * Function polls conversion status with read time slots, like \ref lwow_ds18x20_is_done_raw.
+ * Number of slots in each poll doubles after every unsuccessful poll,
+ * up to \ref LWOW_CFG_DS18X20_POLL_MAX_BYTES bytes, to reduce number of low-level driver calls.
+ * When \ref LWOW_CFG_DS18X20_POLL_DELAY is non-zero, thread sleeps between polls.
+ *
+ * Elapsed time is estimated from number of exchanged slots and sleep time,
+ * hence actual wait may be longer than `timeout` by up to one poll,
+ * or more if low-level driver adds gaps between bytes.
+ *
+ * \note            Works only with externally powered devices, see \ref lwow_ds18x20_is_done_raw
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       timeout: Maximum time to wait in units of milliseconds.
+ *                      Use \ref lwow_ds18x20_get_temp_conversion_time for reasonable value
+ * \return          `1` if conversion completed, `0` on timeout or communication error
+ */
+uint8_t
+lwow_ds18x20_wait_done_raw(lwow_t* const owobj, const uint32_t timeout) {
+    uint8_t buff[LWOW_CFG_DS18X20_POLL_MAX_BYTES];
+    uint32_t elapsed_ms, elapsed_us, slot_time;
+    size_t len = 1;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    /* Single slot first, conversion may be completed already */
+    if (lwow_ds18x20_is_done_raw(owobj)) {
+        return 1;
+    }
+    slot_time = lwow_get_speed(owobj) == LWOW_SPEED_OVERDRIVE ? LWOW_DS18X20_SLOT_TIME_OD : LWOW_DS18X20_SLOT_TIME_STD;
+    elapsed_ms = 0;
+    elapsed_us = slot_time;
+    while (elapsed_ms < timeout) {
+#if LWOW_CFG_DS18X20_POLL_DELAY
+        lwow_sys_delay(LWOW_CFG_DS18X20_POLL_DELAY, owobj->arg);
+        elapsed_ms += LWOW_CFG_DS18X20_POLL_DELAY;
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY */
+
+        /* Any slot read as 1 means all devices released the line */
+        if (lwow_read_bytes_ex_raw(owobj, buff, len) != lwowOK) {
+            return 0;
+        }
+        /* Slot time is counted in microseconds, only remainder is kept to avoid overflow */
+        elapsed_us += 8U * len * slot_time;
+        elapsed_ms += elapsed_us / 1000U;
+        elapsed_us %= 1000U;
+        for (size_t i = 0; i < len; ++i) {
+            if (buff[i] != 0x00U) {
+                return 1;
+            }
+        }
+        len *= 2U;
+        if (len > LWOW_ARRAYSIZE(buff)) {
+            len = LWOW_ARRAYSIZE(buff);
+        }
+    }
+    return 0;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_wait_done_raw
+ * \note            This function is thread-safe.
+ *                      Bus stays locked during entire wait, as any other communication
+ *                      would stop devices from reporting conversion status
+ */
+uint8_t
+lwow_ds18x20_wait_done(lwow_t* const owobj, const uint32_t timeout) {
+    uint8_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_wait_done_raw(owobj, timeout);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+/**
+ * \brief           Keep the bus idle until copy scratchpad command completes
+ *
+ * Devices do not report status of EEPROM write with read time slots,
+ * hence full EEPROM write time is waited instead of polling.
+ * When \ref LWOW_CFG_DS18X20_POLL_DELAY is non-zero, thread sleeps,
+ * otherwise read time slots are generated for at least the same time
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \return          `1` on success, `0` on communication error
+ */
+static uint8_t
+prv_wait_copy(lwow_t* const owobj) {
+#if LWOW_CFG_DS18X20_POLL_DELAY
+    return lwow_sys_delay(LWOW_DS18X20_EEPROM_WRITE_TIME, owobj->arg);
+#else
+    uint8_t buff[LWOW_CFG_DS18X20_POLL_MAX_BYTES];
+    uint32_t byte_time, remaining = LWOW_DS18X20_EEPROM_WRITE_TIME * 1000U;
+    size_t len;
+
+    byte_time = 8U
+                * (lwow_get_speed(owobj) == LWOW_SPEED_OVERDRIVE ? LWOW_DS18X20_SLOT_TIME_OD
+                                                                 : LWOW_DS18X20_SLOT_TIME_STD);
+    while (remaining > 0) {
+        len = (remaining + byte_time - 1U) / byte_time;
+        if (len > LWOW_ARRAYSIZE(buff)) {
+            len = LWOW_ARRAYSIZE(buff);
+        }
+        if (lwow_read_bytes_ex_raw(owobj, buff, len) != lwowOK) {
+            return 0;
+        }
+        remaining = remaining > len * byte_time ? remaining - (uint32_t)(len * byte_time) : 0;
+    }
+    return 1;
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY */
+}
+
+/**
+ * \brief           Get family code of device, scratchpad has been read from
+ * \param[in]       rom_id: 1-Wire device address or `NULL` when skip ROM has been used
+ * \param[in]       data: Scratchpad content, at least `5` bytes long
+ * \return          \ref LWOW_DS18B20_FAMILY_CODE or \ref LWOW_DS18S20_FAMILY_CODE
+ */
+static uint8_t
+prv_get_family(const lwow_rom_t* const rom_id, const uint8_t* data) {
     if (rom_id != NULL) {
-        LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id) || lwow_ds18x20_is_s(owobj, rom_id)",
-                     lwow_ds18x20_is_b(owobj, rom_id) || lwow_ds18x20_is_s(owobj, rom_id));
+        return rom_id->rom[0];
+    }
+    /* Configuration register of DS18B20 has top bit always cleared, DS18S20 has reserved byte `0xFF` there */
+    return (data[4] & 0x80U) ? LWOW_DS18S20_FAMILY_CODE : LWOW_DS18B20_FAMILY_CODE;
+}
+
+/**
+ * \brief           Convert temperature register from scratchpad to signed units of `1/16` degrees Celsius
+ *
+ * `DS18B20` reports temperature in units of `1/16` degrees, with undefined bits of lower resolutions.
+ * `DS18S20` reports temperature in units of `0.5` degrees,
+ * which is refined with `COUNT_REMAIN` and `COUNT_PER_C` registers to extended resolution
+ *
+ * \param[in]       data: Scratchpad content, `9` bytes long
+ * \param[in]       family: Device family code, \ref LWOW_DS18B20_FAMILY_CODE or \ref LWOW_DS18S20_FAMILY_CODE
+ * \return          Temperature in units of `1/16` degrees Celsius
+ */
+static int16_t
+prv_decode_temp(const uint8_t* data, const uint8_t family) {
+    uint16_t temp = 0;
+    uint8_t resolution = 0, m = 0;
+
+    temp = (data[1] << 0x08U) | data[0]; /* Format data in integer format */
+    if (family == LWOW_DS18S20_FAMILY_CODE) {
+        /* Extended resolution: TEMP_READ - 0.25 + (COUNT_PER_C - COUNT_REMAIN) / COUNT_PER_C */
+        if (data[7] != 0 && data[6] <= data[7]) {
+            return (int16_t)((int16_t)(temp & 0xFFFEU) * 8 - 4 + ((data[7] - data[6]) * 16) / data[7]);
+        }
+        return (int16_t)((int16_t)temp * 8);
+    }
+    resolution = ((data[4] & 0x60U) >> 0x05U) + 0x09U; /* Set resolution in units of bits */
+    if (temp & 0x8000U) {                              /* Check for negative temperature */
+        temp = ~temp + 1;                              /* Perform two's complement */
+        m = 1;
     }
+    temp &= 0x07FFU & ~((1U << (12U - resolution)) - 1U); /* Clear undefined bits of lower resolutions */
+    return m ? -(int16_t)temp : (int16_t)temp;
+}
+
+/**
+ * \brief           Read complete scratchpad after temperature conversion and check its CRC
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to read data from
+ * \param[out]      data: Output array of `9` bytes to save scratchpad to
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+prv_read_scratchpad(lwow_t* const owobj, const lwow_rom_t* const rom_id, uint8_t* const data) {
+    uint8_t ret = 0, buff[10] = {0}, bit_val = 0;
 
     /*
      * First read bit and check if all devices completed with conversion.
@@ -103,40 +485,325 @@ lwow_ds18x20_read_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, float
      */
     if (lwow_read_bit_ex_raw(owobj, &bit_val) == lwowOK && bit_val != 0 && lwow_reset_raw(owobj) == lwowOK
         && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-        lwow_write_byte_ex_raw(owobj, LWOW_CMD_RSCRATCHPAD, NULL);
-
-        /* Read plain data from device */
-        for (uint8_t idx = 0; idx < LWOW_ARRAYSIZE(data); ++idx) {
-            lwow_read_byte_ex_raw(owobj, &data[idx]);
-        }
-        crc = lwow_crc(data, LWOW_ARRAYSIZE(data));            /* Calculate CRC */
-        if (crc == 0) {                                        /* Result must be 0 to match the CRC */
-            temp = (data[1] << 0x08U) | data[0];               /* Format data in integer format */
-            resolution = ((data[4] & 0x60U) >> 0x05U) + 0x09U; /* Set resolution in units of bits */
-            if (temp & 0x8000U) {                              /* Check for negative temperature */
-                temp = ~temp + 1;                              /* Perform two's complement */
-                m = 1;
-            }
-            digit = (temp >> 0x04U) | (((temp >> 0x08U) & 0x07U) << 0x04U);
-            switch (resolution) { /* Check for resolution settings */
-                case 9U: dec = ((temp >> 0x03U) & 0x01U) * 0.5f; break;
-                case 10U: dec = ((temp >> 0x02U) & 0x03U) * 0.25f; break;
-                case 11U: dec = ((temp >> 0x01U) & 0x07U) * 0.125f; break;
-                case 12U: dec = (temp & 0x0FU) * 0.0625f; break;
-                default: dec = 0xFFU, digit = 0;
-            }
-            dec += digit;
-            if (m) {
-                dec = -dec;
-            }
-            *temp_out = dec;
+        /* Send read scratchpad command and read plain data from device in one go */
+        LWOW_MEMSET(buff, 0xFF, sizeof(buff));
+        buff[0] = LWOW_CMD_RSCRATCHPAD;
+        lwow_write_bytes_ex_raw(owobj, buff, buff, sizeof(buff));
+        if (lwow_crc(&buff[1], sizeof(buff) - 1U) == 0) { /* Result must be 0 to match the CRC */
+            LWOW_MEMCPY(data, &buff[1], sizeof(buff) - 1U);
+            prv_cache_store(owobj, rom_id, data);
             ret = 1;
         }
     }
-
     return ret;
 }
 
+/**
+ * \brief           Read temperature register and convert it to signed units of `1/16` degrees Celsius
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to read data from
+ * \param[out]      temp_out: Pointer to output variable to save temperature
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+prv_read_temp(lwow_t* const owobj, const lwow_rom_t* const rom_id, int16_t* const temp_out) {
+    uint8_t data[9];
+
+    if (prv_read_scratchpad(owobj, rom_id, data)) {
+        *temp_out = prv_decode_temp(data, prv_get_family(rom_id, data));
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * \brief           Convert temperature in units of `1/16` degrees Celsius to milli-degrees Celsius
+ *
+ * Result is rounded to nearest integer, half away from zero
+ *
+ * \param[in]       temp: Temperature in units of `1/16` degrees Celsius,
+ *                      as returned by \ref lwow_ds18x20_read_fixed16_raw
+ * \return          Temperature in units of milli-degrees Celsius
+ */
+int32_t
+lwow_ds18x20_fixed16_to_milli(int16_t temp) {
+    int32_t t = (int32_t)temp * 125;
+
+    return (t + (t < 0 ? -1 : 1)) / 2;
+}
+
+/**
+ * \brief           Read temperature previously started with \ref lwow_ds18x20_start,
+ *                  in units of `1/16` degrees Celsius
+ *
+ * For `DS18B20`, function returns signed content of temperature register, with undefined bits of
+ * lower resolutions cleared. `DS18S20` register in units of `0.5` degrees is scaled to the same units,
+ * and refined with count remain registers. It does not use floating point operations.
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to read data from
+ * \param[out]      temp_out: Pointer to output variable to save temperature
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwow_ds18x20_read_fixed16_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int16_t* const temp_out) {
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT0("temp_out != NULL", temp_out != NULL);
+    if (rom_id != NULL) {
+        LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id) || lwow_ds18x20_is_s(owobj, rom_id)",
+                     lwow_ds18x20_is_b(owobj, rom_id) || lwow_ds18x20_is_s(owobj, rom_id));
+    }
+
+    return prv_read_temp(owobj, rom_id, temp_out);
+}
+
+/**
+ * \copydoc         lwow_ds18x20_read_fixed16_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_read_fixed16(lwow_t* const owobj, const lwow_rom_t* const rom_id, int16_t* const temp_out) {
+    uint8_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_read_fixed16_raw(owobj, rom_id, temp_out);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+/**
+ * \brief           Read temperature previously started with \ref lwow_ds18x20_start,
+ *                  in units of milli-degrees Celsius
+ *
+ * Function does not use floating point operations
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to read data from
+ * \param[out]      temp_out: Pointer to output variable to save temperature
+ * \return          `1` on success, `0` otherwise
+ * \sa              lwow_ds18x20_fixed16_to_milli
+ */
+uint8_t
+lwow_ds18x20_read_fixed_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int32_t* const temp_out) {
+    int16_t temp = 0;
+
+    LWOW_ASSERT0("temp_out != NULL", temp_out != NULL);
+
+    if (lwow_ds18x20_read_fixed16_raw(owobj, rom_id, &temp)) {
+        *temp_out = lwow_ds18x20_fixed16_to_milli(temp);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_read_fixed_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_read_fixed(lwow_t* const owobj, const lwow_rom_t* const rom_id, int32_t* const temp_out) {
+    uint8_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_read_fixed_raw(owobj, rom_id, temp_out);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+/**
+ * \brief           Read temperatures of many devices, previously started with \ref lwow_ds18x20_start
+ *
+ * Conversion status is checked only once for all devices. Each device is then read
+ * with the same prepared transaction (reset, match ROM, read scratchpad and CRC check),
+ * which merges all time slots of a device into the fewest possible low-level calls.
+ *
+ * Failure of single device does not stop the batch, its status is reported in `status_out` array:
+ *
+ *  - \ref lwowOK: Temperature has been read successfully
+ *  - \ref lwowERRBUSY: Conversion is still in progress, no device has been read
+ *  - \ref lwowERRPAR: ROM address does not belong to `DS18x20` device
+ *  - \ref lwowERRPRESENCE: No presence pulse on reset
+ *  - \ref lwowERRCRC: Scratchpad CRC mismatch, device did not respond or data were corrupted
+ *  - Other member of \ref lwowr_t on low-level communication error.
+ *      Batch is stopped and remaining devices report the same status
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_ids: Array of device addresses to read
+ * \param[in]       cnt: Number of devices in `rom_ids` array
+ * \param[out]      temps_out: Array of at least `cnt` elements to save temperatures
+ *                      in units of milli-degrees Celsius to. Elements of failed devices are not modified
+ * \param[out]      status_out: Array of at least `cnt` elements to save status of each device to.
+ *                      Can be set to `NULL` if not used
+ * \return          Number of successfully read devices
+ */
+size_t
+lwow_ds18x20_read_many_raw(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt,
+                           int32_t* const temps_out, lwowr_t* const status_out) {
+    lwow_txn_t txn;
+    lwow_rom_t rom;
+    lwowr_t res;
+    size_t ok_cnt = 0;
+    uint8_t data[9], bit_val = 0, stop = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT0("rom_ids != NULL", rom_ids != NULL);
+    LWOW_ASSERT0("temps_out != NULL", temps_out != NULL);
+
+    /* Transaction is prepared once and then reused for every device */
+    lwow_txn_init(&txn);
+    lwow_txn_add_reset(&txn);
+    lwow_txn_add_select(&txn, &rom);
+    lwow_txn_add_write_byte(&txn, LWOW_CMD_RSCRATCHPAD);
+    lwow_txn_add_read(&txn, data, sizeof(data));
+    lwow_txn_add_crc_check(&txn, data, sizeof(data));
+
+    /* All started devices must complete conversion first */
+    res = lwow_read_bit_ex_raw(owobj, &bit_val);
+    if (res == lwowOK && bit_val == 0) {
+        res = lwowERRBUSY;
+    }
+    stop = res != lwowOK;
+    for (size_t i = 0; i < cnt; ++i) {
+        if (!stop) {
+            if (lwow_ds18x20_is_b(owobj, &rom_ids[i]) || lwow_ds18x20_is_s(owobj, &rom_ids[i])) {
+                LWOW_MEMCPY(&rom, &rom_ids[i], sizeof(rom));
+                res = lwow_txn_execute_raw(owobj, &txn);
+                if (res == lwowOK) {
+                    temps_out[i] = lwow_ds18x20_fixed16_to_milli(prv_decode_temp(data, rom.rom[0]));
+                    prv_cache_store(owobj, &rom, data);
+                    ++ok_cnt;
+                } else if (res != lwowERRPRESENCE && res != lwowERRCRC) {
+                    stop = 1; /* Low-level communication failed, report it for remaining devices */
+                }
+            } else {
+                res = lwowERRPAR;
+            }
+        }
+        if (status_out != NULL) {
+            status_out[i] = res;
+        }
+    }
+    return ok_cnt;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_read_many_raw
+ * \note            This function is thread-safe
+ */
+size_t
+lwow_ds18x20_read_many(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt, int32_t* const temps_out,
+                       lwowr_t* const status_out) {
+    size_t res = 0;
+    lwowr_t prot;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    if ((prot = lwow_protect(owobj, 1)) != lwowOK) {
+        for (size_t i = 0; status_out != NULL && i < cnt; ++i) {
+            status_out[i] = prot;
+        }
+        return 0;
+    }
+    res = lwow_ds18x20_read_many_raw(owobj, rom_ids, cnt, temps_out, status_out);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+/**
+ * \brief           Read temperature, resolution and alarm thresholds previously started
+ *                  with \ref lwow_ds18x20_start, in single bus pass
+ *
+ * Complete scratchpad is read and CRC-checked once, and all values are decoded from it,
+ * instead of separate calls to \ref lwow_ds18x20_read_raw, \ref lwow_ds18x20_get_resolution_raw
+ * and \ref lwow_ds18x20_get_alarm_temp_raw
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to read data from
+ * \param[out]      data_out: Pointer to output structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwow_ds18x20_read_ex_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, lwow_ds18x20_data_t* const data_out) {
+    uint8_t *data, family;
+    int16_t temp;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT0("data_out != NULL", data_out != NULL);
+    if (rom_id != NULL) {
+        LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id) || lwow_ds18x20_is_s(owobj, rom_id)",
+                     lwow_ds18x20_is_b(owobj, rom_id) || lwow_ds18x20_is_s(owobj, rom_id));
+    }
+
+    data = data_out->scratchpad;
+    if (!prv_read_scratchpad(owobj, rom_id, data)) {
+        return 0;
+    }
+    family = prv_get_family(rom_id, data);
+    temp = prv_decode_temp(data, family);
+    data_out->temp_raw = (int16_t)((data[1] << 0x08U) | data[0]);
+    data_out->temp_milli = lwow_ds18x20_fixed16_to_milli(temp);
+#if LWOW_CFG_FLOAT
+    data_out->temp = (float)temp * 0.0625f;
+#endif /* LWOW_CFG_FLOAT */
+    data_out->alarm_h = (int8_t)data[2];
+    data_out->alarm_l = (int8_t)data[3];
+    if (family == LWOW_DS18S20_FAMILY_CODE) {
+        data_out->resolution = 9U; /* DS18S20 has fixed resolution */
+    } else {
+        data_out->resolution = ((data[4] & 0x60U) >> 0x05U) + 9U;
+    }
+    return 1;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_read_ex_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_read_ex(lwow_t* const owobj, const lwow_rom_t* const rom_id, lwow_ds18x20_data_t* const data_out) {
+    uint8_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_read_ex_raw(owobj, rom_id, data_out);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+#if LWOW_CFG_FLOAT || __DOXYGEN__
+
+/**
+ * \brief           Read temperature previously started with \ref lwow_ds18x20_start
+ * \note            Function is available only when \ref LWOW_CFG_FLOAT is enabled
+ * \param[in]       ow: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to read data from
+ * \param[out]      temp_out: Pointer to output float variable to save temperature
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwow_ds18x20_read_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, float* const temp_out) {
+    int16_t temp = 0;
+
+    LWOW_ASSERT0("temp_out != NULL", temp_out != NULL);
+
+    if (lwow_ds18x20_read_fixed16_raw(owobj, rom_id, &temp)) {
+        *temp_out = (float)temp * 0.0625f;
+        return 1;
+    }
+    return 0;
+}
+
 /**
  * \copydoc         lwow_ds18x20_read_raw
  * \note            This function is thread-safe
@@ -152,62 +819,203 @@ lwow_ds18x20_read(lwow_t* const owobj, const lwow_rom_t* const rom_id, float* co
                      lwow_ds18x20_is_b(owobj, rom_id) || lwow_ds18x20_is_s(owobj, rom_id));
     }
 
-    lwow_protect(owobj, 1);
-    res = lwow_ds18x20_read_raw(owobj, rom_id, t);
-    lwow_unprotect(owobj, 1);
-    return res;
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_read_raw(owobj, rom_id, t);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+#endif /* LWOW_CFG_FLOAT || __DOXYGEN__ */
+
+/**
+ * \brief           Get resolution for `DS18B20` device
+ * \param[in]       ow: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to get resolution from
+ * \return          Resolution in units of bits (`9 - 12`) on success, `0` otherwise
+ */
+uint8_t
+lwow_ds18x20_get_resolution_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint8_t res = 0, cfg[3];
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT0("rom_id != NULL", rom_id != NULL);
+    LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
+
+    if (prv_get_config(owobj, rom_id, cfg)) {
+        res = ((cfg[2] & 0x60U) >> 0x05U) + 9U; /* Read configuration byte and calculate bits */
+    }
+
+    return res;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_get_resolution_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_get_resolution(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint8_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT0("rom_id != NULL", rom_id != NULL);
+    LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_get_resolution_raw(owobj, rom_id);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+/**
+ * \brief           Write resolution and alarm temperatures to device, when they differ from current ones
+ *
+ * Requested values are compared against scratchpad content.
+ * Write is skipped when scratchpad already has requested configuration.
+ * When `persist` is set to `1`, scratchpad is still copied to EEPROM,
+ * unless it is known to match EEPROM, as it may hold change made with `persist` set to `0`.
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \param[in]       bits: Number of resolution bits, `9 - 12`, or `0` to keep current resolution
+ * \param[in]       temp_l: Alarm low temperature, already limited to valid range,
+ *                      or \ref LWOW_DS18X20_ALARM_NOCHANGE
+ * \param[in]       temp_h: Alarm high temperature, already limited to valid range,
+ *                      or \ref LWOW_DS18X20_ALARM_NOCHANGE
+ * \param[in]       persist: Set to `1` to copy scratchpad to EEPROM, `0` to keep change in scratchpad only
+ * \param[in]       synced: Set to `1` when scratchpad is known to match EEPROM, such as after recall
+ * \param[out]      changed: Output variable set to `1` when scratchpad has been written, `0` otherwise.
+ *                      Can be set to `NULL` if not used
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_set_config(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits, const int8_t temp_l,
+               const int8_t temp_h, const uint8_t persist, const uint8_t synced, uint8_t* const changed) {
+    lwowr_t res;
+    uint8_t buff[10], *data = &buff[1], cfg[3];
+
+    if (changed != NULL) {
+        *changed = 0;
+    }
+    prv_cache_invalidate(owobj, rom_id);
+
+    /* Read complete scratchpad; temperature (ignored), high and low alarm and configuration */
+    if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_match_or_skip_rom_raw(owobj, rom_id)) != lwowOK) {
+        return res;
+    }
+    LWOW_MEMSET(buff, 0xFF, sizeof(buff));
+    buff[0] = LWOW_CMD_RSCRATCHPAD;
+    if ((res = lwow_write_bytes_ex_raw(owobj, buff, buff, sizeof(buff))) != lwowOK) {
+        return res;
+    }
+    if (lwow_crc(data, sizeof(buff) - 1U) != 0) {
+        return lwowERRCRC;
+    }
+
+    /* Fill new values, configuration register of DS18S20 is reserved */
+    LWOW_MEMCPY(cfg, &data[2], sizeof(cfg));
+    if (temp_h != LWOW_DS18X20_ALARM_NOCHANGE) {
+        cfg[0] = (uint8_t)temp_h;
+    }
+    if (temp_l != LWOW_DS18X20_ALARM_NOCHANGE) {
+        cfg[1] = (uint8_t)temp_l;
+    }
+    if (bits != 0 && (rom_id == NULL || lwow_ds18x20_is_b(owobj, rom_id))) {
+        cfg[2] = (cfg[2] & ~0x60U) | (uint8_t)((bits - 9U) << 0x05U);
+    }
+    if (LWOW_MEMCMP(cfg, &data[2], sizeof(cfg)) == 0) {
+        prv_cache_store(owobj, rom_id, data);
+        if (synced) {
+            prv_cache_set_synced(owobj, rom_id, 1);
+        }
+        if (!persist || synced || prv_cache_is_synced(owobj, rom_id)) {
+            return lwowOK; /* Device already has requested configuration */
+        }
+    } else {
+        /* Write scratchpad */
+        buff[0] = LWOW_CMD_WSCRATCHPAD;
+        LWOW_MEMCPY(&buff[1], cfg, sizeof(cfg));
+        if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_match_or_skip_rom_raw(owobj, rom_id)) != lwowOK
+            || (res = lwow_write_bytes_ex_raw(owobj, buff, NULL, 4)) != lwowOK) {
+            return res;
+        }
+        if (changed != NULL) {
+            *changed = 1; /* Device has been modified, even if copy to EEPROM fails */
+        }
+        prv_cache_set_synced(owobj, rom_id, 0);
+        if (!persist) {
+            return lwowOK;
+        }
+    }
+
+    /* Copy scratchpad to non-volatile memory, devices do not report completion */
+    if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_match_or_skip_rom_raw(owobj, rom_id)) != lwowOK
+        || (res = lwow_write_byte_ex_raw(owobj, LWOW_CMD_CPYSCRATCHPAD, NULL)) != lwowOK) {
+        return res;
+    }
+    if (!prv_wait_copy(owobj)) {
+        return lwowERR;
+    }
+    prv_cache_set_synced(owobj, rom_id, 1);
+    return lwowOK;
 }
 
 /**
- * \brief           Get resolution for `DS18B20` device
- * \param[in]       ow: 1-Wire handle
- * \param[in]       rom_id: 1-Wire device address to get resolution from
- * \return          Resolution in units of bits (`9 - 12`) on success, `0` otherwise
+ * \brief           Set resolution for `DS18B20` sensor, with optional write to EEPROM
+ *
+ * When `persist` is set to `0`, new resolution is written to scratchpad only.
+ * It is effective immediately, but it is lost on power-up or \ref lwow_ds18x20_recall_raw call.
+ * This avoids EEPROM write time and wear, when resolution is changed often
+ *
+ * Scratchpad is not written, if it already has requested resolution.
+ * With `persist` set to `1`, scratchpad is then still copied to EEPROM, as it may hold
+ * change made before with `persist` set to `0`. Copy is skipped only when scratchpad is known to match EEPROM,
+ * which requires \ref LWOW_CFG_DEV_CACHE_SIZE and no scratchpad-only change since last copy or recall.
+ * Use \ref lwow_ds18x20_reconcile_raw to avoid EEPROM writes for devices without cache entry
+ *
+ * \note            `DS18S20` has fixed `9-bit` resolution
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to set resolution
+ * \param[in]       bits: Number of resolution bits. Possible values are `9 - 12`
+ * \param[in]       persist: Set to `1` to copy scratchpad to EEPROM, `0` to keep change in scratchpad only
+ * \return          `1` on success, `0` otherwise
  */
 uint8_t
-lwow_ds18x20_get_resolution_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
-    uint8_t res = 0, bresol = 0;
-
+lwow_ds18x20_set_resolution_ex_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits,
+                                   const uint8_t persist) {
     LWOW_ASSERT0("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT0("rom_id != NULL", rom_id != NULL);
+    LWOW_ASSERT0("bits >= 9U && bits <= 12U", bits >= 9U && bits <= 12U);
     LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
 
-    if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-        lwow_write_byte_ex_raw(owobj, LWOW_CMD_RSCRATCHPAD, NULL);
-
-        /* Read and ignore bytes */
-        lwow_read_byte_ex_raw(owobj, &bresol);
-        lwow_read_byte_ex_raw(owobj, &bresol);
-        lwow_read_byte_ex_raw(owobj, &bresol);
-        lwow_read_byte_ex_raw(owobj, &bresol);
-
-        lwow_read_byte_ex_raw(owobj, &bresol);
-        res = ((bresol & 0x60U) >> 0x05U) + 9U; /* Read configuration byte and calculate bits */
-    }
-
-    return res;
+    return prv_set_config(owobj, rom_id, bits, LWOW_DS18X20_ALARM_NOCHANGE, LWOW_DS18X20_ALARM_NOCHANGE, persist,
+                          0, NULL)
+           == lwowOK;
 }
 
 /**
- * \copydoc         lwow_ds18x20_get_resolution_raw
+ * \copydoc         lwow_ds18x20_set_resolution_ex_raw
  * \note            This function is thread-safe
  */
 uint8_t
-lwow_ds18x20_get_resolution(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+lwow_ds18x20_set_resolution_ex(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits,
+                               const uint8_t persist) {
     uint8_t res = 0;
 
     LWOW_ASSERT0("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT0("rom_id != NULL", rom_id != NULL);
-    LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
 
-    lwow_protect(owobj, 1);
-    res = lwow_ds18x20_get_resolution_raw(owobj, rom_id);
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_set_resolution_ex_raw(owobj, rom_id, bits, persist);
     lwow_unprotect(owobj, 1);
     return res;
 }
 
 /**
- * \brief           Set resolution for `DS18B20` sensor
+ * \brief           Set resolution for `DS18B20` sensor and write it to EEPROM
  * \note            `DS18S20` has fixed `9-bit` resolution
  * \param[in]       ow: 1-Wire handle
  * \param[in]       rom_id: 1-Wire device address to set resolution
@@ -216,49 +1024,7 @@ lwow_ds18x20_get_resolution(lwow_t* const owobj, const lwow_rom_t* const rom_id)
  */
 uint8_t
 lwow_ds18x20_set_resolution_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits) {
-    uint8_t thigh = 0, tlow = 0, conf = 0, res = 0;
-
-    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT0("bits >= 9U && bits <= 12U", bits >= 9U && bits <= 12U);
-    LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
-
-    if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-        lwow_write_byte_ex_raw(owobj, LWOW_CMD_RSCRATCHPAD, NULL);
-
-        /* Read and ignore bytes */
-        lwow_read_byte_ex_raw(owobj, &thigh);
-        lwow_read_byte_ex_raw(owobj, &thigh);
-
-        /* Read important data */
-        lwow_read_byte_ex_raw(owobj, &thigh);
-        lwow_read_byte_ex_raw(owobj, &tlow);
-        lwow_read_byte_ex_raw(owobj, &conf);
-
-        conf &= ~0x60U; /* Remove configuration bits for temperature resolution */
-        switch (bits) {
-            case 12U: conf |= 0x60U; break;
-            case 11U: conf |= 0x40U; break;
-            case 10U: conf |= 0x20U; break;
-            case 9U:
-            default: break;
-        }
-
-        /* Write data back to device */
-        if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-            lwow_write_byte_ex_raw(owobj, LWOW_CMD_WSCRATCHPAD, NULL);
-
-            lwow_write_byte_ex_raw(owobj, thigh, NULL);
-            lwow_write_byte_ex_raw(owobj, tlow, NULL);
-            lwow_write_byte_ex_raw(owobj, conf, NULL);
-
-            /* Copy scratchpad to non-volatile memory */
-            if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-                lwow_write_byte_ex_raw(owobj, LWOW_CMD_CPYSCRATCHPAD, NULL);
-                res = 1;
-            }
-        }
-    }
-    return res;
+    return lwow_ds18x20_set_resolution_ex_raw(owobj, rom_id, bits, 1);
 }
 
 /**
@@ -273,12 +1039,37 @@ lwow_ds18x20_set_resolution(lwow_t* const owobj, const lwow_rom_t* const rom_id,
     LWOW_ASSERT0("bits >= 9U && bits <= 12U", bits >= 9U && bits <= 12U);
     LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
 
-    lwow_protect(owobj, 1);
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
     res = lwow_ds18x20_set_resolution_raw(owobj, rom_id, bits);
     lwow_unprotect(owobj, 1);
     return res;
 }
 
+/**
+ * \brief           Limit alarm temperatures to valid range and apply \ref LWOW_DS18X20_ALARM_DISABLE
+ * \param[in,out]   temp_l: Alarm low temperature
+ * \param[in,out]   temp_h: Alarm high temperature
+ */
+static void
+prv_alarm_limit(int8_t* const temp_l, int8_t* const temp_h) {
+    if (*temp_l != LWOW_DS18X20_ALARM_NOCHANGE) {
+        if (*temp_l == LWOW_DS18X20_ALARM_DISABLE || *temp_l < LWOW_DS18X20_TEMP_MIN) {
+            *temp_l = LWOW_DS18X20_TEMP_MIN;
+        } else if (*temp_l > LWOW_DS18X20_TEMP_MAX) {
+            *temp_l = LWOW_DS18X20_TEMP_MAX;
+        }
+    }
+    if (*temp_h != LWOW_DS18X20_ALARM_NOCHANGE) {
+        if (*temp_h == LWOW_DS18X20_ALARM_DISABLE || *temp_h > LWOW_DS18X20_TEMP_MAX) {
+            *temp_h = LWOW_DS18X20_TEMP_MAX;
+        } else if (*temp_h < LWOW_DS18X20_TEMP_MIN) {
+            *temp_h = LWOW_DS18X20_TEMP_MIN;
+        }
+    }
+}
+
 /**
  * \brief           Set/clear temperature alarm high/low levels in units of degree Celcius
  * \note            `temp_h` and `temp_l` are high and low temperature alarms and can accept different values:
@@ -299,16 +1090,20 @@ lwow_ds18x20_set_alarm_temp(&ow, dev_id, 10, 30);
 \endcode
  *
  *
- * \param[in]       ow: 1-Wire handle
+ * When `persist` is set to `0`, new values are written to scratchpad only.
+ * Nothing is written when device already has requested alarm temperatures,
+ * see \ref lwow_ds18x20_set_resolution_ex_raw for details.
+ *
+ * \param[in]       owobj: 1-Wire handle
  * \param[in]       rom_id: 1-Wire device address
  * \param[in]       temp_l: Alarm low temperature
  * \param[in]       temp_h: Alarm high temperature
+ * \param[in]       persist: Set to `1` to copy scratchpad to EEPROM, `0` to keep change in scratchpad only
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
-lwow_ds18x20_set_alarm_temp_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l, int8_t temp_h) {
-    uint8_t res = 0, conf = 0, thigh = 0, tlow = 0;
-
+lwow_ds18x20_set_alarm_temp_ex_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l, int8_t temp_h,
+                                   const uint8_t persist) {
     LWOW_ASSERT0("owobj != NULL", owobj != NULL);
     LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
 
@@ -318,54 +1113,83 @@ lwow_ds18x20_set_alarm_temp_raw(lwow_t* const owobj, const lwow_rom_t* const rom
     }
 
     /* Check valid temp range for temperatures */
-    if (temp_l != LWOW_DS18X20_ALARM_NOCHANGE) {
-        if (temp_l == LWOW_DS18X20_ALARM_DISABLE || temp_l < LWOW_DS18X20_TEMP_MIN) {
-            temp_l = LWOW_DS18X20_TEMP_MIN;
-        } else if (temp_l > LWOW_DS18X20_TEMP_MAX) {
-            temp_l = LWOW_DS18X20_TEMP_MAX;
-        }
-    }
-    if (temp_h != LWOW_DS18X20_ALARM_NOCHANGE) {
-        if (temp_h == LWOW_DS18X20_ALARM_DISABLE || temp_h > LWOW_DS18X20_TEMP_MAX) {
-            temp_h = LWOW_DS18X20_TEMP_MAX;
-        } else if (temp_h < LWOW_DS18X20_TEMP_MIN) {
-            temp_h = LWOW_DS18X20_TEMP_MIN;
-        }
-    }
+    prv_alarm_limit(&temp_l, &temp_h);
+    return prv_set_config(owobj, rom_id, 0, temp_l, temp_h, persist, 0, NULL) == lwowOK;
+}
 
-    if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-        lwow_write_byte_ex_raw(owobj, LWOW_CMD_RSCRATCHPAD, NULL);
+/**
+ * \copydoc         lwow_ds18x20_set_alarm_temp_ex_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_set_alarm_temp_ex(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l, int8_t temp_h,
+                               const uint8_t persist) {
+    uint8_t res = 0;
 
-        /* Read and ignore 2 bytes */
-        lwow_read_byte_ex_raw(owobj, &thigh);
-        lwow_read_byte_ex_raw(owobj, &thigh);
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
 
-        /* Read important data */
-        lwow_read_byte_ex_raw(owobj, &thigh);
-        lwow_read_byte_ex_raw(owobj, &tlow);
-        lwow_read_byte_ex_raw(owobj, &conf);
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_set_alarm_temp_ex_raw(owobj, rom_id, temp_l, temp_h, persist);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
 
-        /* Fill new values */
-        thigh = temp_h == LWOW_DS18X20_ALARM_NOCHANGE ? (uint8_t)thigh : (uint8_t)temp_h;
-        tlow = temp_l == LWOW_DS18X20_ALARM_NOCHANGE ? (uint8_t)tlow : (uint8_t)temp_l;
+/**
+ * \brief           Set/clear temperature alarm high/low levels and write them to EEPROM
+ * \param[in]       ow: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \param[in]       temp_l: Alarm low temperature
+ * \param[in]       temp_h: Alarm high temperature
+ * \return          `1` on success, `0` otherwise
+ * \sa              lwow_ds18x20_set_alarm_temp_ex_raw
+ */
+uint8_t
+lwow_ds18x20_set_alarm_temp_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l, int8_t temp_h) {
+    return lwow_ds18x20_set_alarm_temp_ex_raw(owobj, rom_id, temp_l, temp_h, 1);
+}
 
-        /* Write scratchpad */
-        if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-            lwow_write_byte_ex_raw(owobj, LWOW_CMD_WSCRATCHPAD, NULL);
+/**
+ * \brief           Restore resolution and alarm temperatures from EEPROM to scratchpad
+ *
+ * Function reverts changes made with `persist` parameter set to `0`.
+ * Completion is polled with read slots, see \ref lwow_ds18x20_wait_done_raw
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address.
+ *                      Set to `NULL` to restore all devices on the bus at the same time
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+lwow_ds18x20_recall_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    prv_cache_invalidate(owobj, rom_id);
+    if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK
+        && lwow_write_byte_ex_raw(owobj, LWOW_CMD_RECEEPROM, NULL) == lwowOK
+        && lwow_ds18x20_wait_done_raw(owobj, LWOW_DS18X20_EEPROM_WRITE_TIME)) {
+        prv_cache_set_synced(owobj, rom_id, 1);
+        return 1;
+    }
+    return 0;
+}
 
-            /* Write configuration register */
-            lwow_write_byte_ex_raw(owobj, thigh, NULL);
-            lwow_write_byte_ex_raw(owobj, tlow, NULL);
-            lwow_write_byte_ex_raw(owobj, conf, NULL);
+/**
+ * \copydoc         lwow_ds18x20_recall_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_recall(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint8_t res = 0;
 
-            /* Copy scratchpad to memory */
-            if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-                lwow_write_byte_ex_raw(owobj, LWOW_CMD_CPYSCRATCHPAD, NULL);
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
 
-                res = 1;
-            }
-        }
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
     }
+    res = lwow_ds18x20_recall_raw(owobj, rom_id);
+    lwow_unprotect(owobj, 1);
     return res;
 }
 
@@ -380,12 +1204,313 @@ lwow_ds18x20_set_alarm_temp(lwow_t* const owobj, const lwow_rom_t* const rom_id,
     LWOW_ASSERT0("owobj != NULL", owobj != NULL);
     LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
 
-    lwow_protect(owobj, 1);
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
     res = lwow_ds18x20_set_alarm_temp_raw(owobj, rom_id, temp_l, temp_h);
     lwow_unprotect(owobj, 1);
     return res;
 }
 
+/**
+ * \brief           Write, copy, recall and verify configuration of devices
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       buff: Write scratchpad frame with requested `TH`, `TL` and configuration register
+ * \param[in]       temp_l: Alarm low temperature, already limited, or \ref LWOW_DS18X20_ALARM_NOCHANGE
+ * \param[in]       temp_h: Alarm high temperature, already limited, or \ref LWOW_DS18X20_ALARM_NOCHANGE
+ * \param[in]       rom_ids: Array of device addresses.
+ *                      Up to `32` devices, when alarm values are preserved
+ * \param[in]       cnt: Number of devices in `rom_ids` array
+ * \param[out]      status_out: Array to save status of each device to. Can be set to `NULL` if not used
+ * \return          \ref lwowOK if all devices have been configured and verified,
+ *                      \ref lwowERR if any device failed, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_configure_devices(lwow_t* const owobj, uint8_t* const buff, const int8_t temp_l, const int8_t temp_h,
+                      const lwow_rom_t* const rom_ids, const size_t cnt, lwowr_t* const status_out) {
+    lwow_txn_t txn;
+    lwow_rom_t rom;
+    lwowr_t res, dev_res;
+    uint32_t skipped = 0;
+    uint8_t data[9], preserve;
+
+    preserve = temp_l == LWOW_DS18X20_ALARM_NOCHANGE || temp_h == LWOW_DS18X20_ALARM_NOCHANGE;
+
+    /* Complete scratchpad of single device, checked for CRC */
+    lwow_txn_init(&txn);
+    lwow_txn_add_reset(&txn);
+    lwow_txn_add_select(&txn, &rom);
+    lwow_txn_add_write_byte(&txn, LWOW_CMD_RSCRATCHPAD);
+    lwow_txn_add_read(&txn, data, sizeof(data));
+    lwow_txn_add_crc_check(&txn, data, sizeof(data));
+
+    if (preserve) {
+        /* Each device keeps its own alarm value, hence it has to be read and written separately */
+        for (size_t i = 0; i < cnt; ++i) {
+            LWOW_MEMCPY(&rom, &rom_ids[i], sizeof(rom));
+            prv_cache_invalidate(owobj, &rom);
+            prv_cache_set_synced(owobj, &rom, 0);
+            dev_res = lwow_txn_execute_raw(owobj, &txn);
+            if (dev_res == lwowERRPRESENCE || dev_res == lwowERRCRC) {
+                /* Device is not written, corrupted alarm values must not reach its EEPROM */
+                skipped |= 1UL << i;
+                if (status_out != NULL) {
+                    status_out[i] = dev_res;
+                }
+                continue;
+            } else if (dev_res != lwowOK) {
+                return dev_res;
+            }
+            buff[1] = temp_h == LWOW_DS18X20_ALARM_NOCHANGE ? data[2] : (uint8_t)temp_h;
+            buff[2] = temp_l == LWOW_DS18X20_ALARM_NOCHANGE ? data[3] : (uint8_t)temp_l;
+            if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_match_rom_raw(owobj, &rom)) != lwowOK
+                || (res = lwow_write_bytes_ex_raw(owobj, buff, NULL, 4)) != lwowOK) {
+                return res;
+            }
+        }
+    } else {
+        prv_cache_invalidate(owobj, NULL);
+        prv_cache_set_synced(owobj, NULL, 0);
+        if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_skip_rom_raw(owobj)) != lwowOK
+            || (res = lwow_write_bytes_ex_raw(owobj, buff, NULL, 4)) != lwowOK) {
+            return res;
+        }
+    }
+
+    /* Copy scratchpad of all devices to EEPROM and recall it back, to verify actual EEPROM content */
+    if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_skip_rom_raw(owobj)) != lwowOK
+        || (res = lwow_write_byte_ex_raw(owobj, LWOW_CMD_CPYSCRATCHPAD, NULL)) != lwowOK) {
+        return res;
+    }
+    if (!prv_wait_copy(owobj)) {
+        return lwowERR;
+    }
+    if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_skip_rom_raw(owobj)) != lwowOK
+        || (res = lwow_write_byte_ex_raw(owobj, LWOW_CMD_RECEEPROM, NULL)) != lwowOK) {
+        return res;
+    }
+    if (!lwow_ds18x20_wait_done_raw(owobj, LWOW_DS18X20_EEPROM_WRITE_TIME)) {
+        return lwowERR;
+    }
+
+    /* Verify all written devices with the same transaction */
+    res = lwowOK;
+    for (size_t i = 0; i < cnt; ++i) {
+        if (preserve && (skipped & (1UL << i))) {
+            res = lwowERR; /* Device has not been written, status is already set */
+            continue;
+        }
+        LWOW_MEMCPY(&rom, &rom_ids[i], sizeof(rom));
+        dev_res = lwow_txn_execute_raw(owobj, &txn);
+        if (dev_res == lwowOK) {
+            prv_cache_store(owobj, &rom, data);
+            prv_cache_set_synced(owobj, &rom, 1); /* Scratchpad has just been recalled */
+            if ((temp_h != LWOW_DS18X20_ALARM_NOCHANGE && data[2] != (uint8_t)temp_h)
+                || (temp_l != LWOW_DS18X20_ALARM_NOCHANGE && data[3] != (uint8_t)temp_l)
+                || (lwow_ds18x20_is_b(owobj, &rom) && (data[4] & 0x60U) != (buff[3] & 0x60U))) {
+                dev_res = lwowERR;
+            }
+        } else if (dev_res != lwowERRPRESENCE && dev_res != lwowERRCRC) {
+            return dev_res;
+        }
+        if (dev_res != lwowOK) {
+            res = lwowERR;
+        }
+        if (status_out != NULL) {
+            status_out[i] = dev_res;
+        }
+    }
+    return res;
+}
+
+/**
+ * \brief           Configure resolution and alarm temperatures of all devices on the bus at once
+ *
+ * Function is optimized for commissioning of many devices to the same settings:
+ *
+ *  - Scratchpad is written to all devices with single broadcast (skip ROM) command.
+ *      When any alarm temperature is \ref LWOW_DS18X20_ALARM_NOCHANGE, each device is read
+ *      (complete scratchpad, checked for CRC) and written separately, to keep its own alarm value.
+ *      Device that cannot be read is not written and is reported in `status_out`
+ *  - Scratchpad is copied to EEPROM with single broadcast command, followed by full EEPROM write time.
+ *      Devices do not report copy completion, hence it is not polled
+ *  - EEPROM is recalled back to scratchpad with single broadcast command
+ *  - Every device in `rom_ids` is verified by reading its scratchpad, with the same prepared transaction
+ *
+ * Per-device result is written to `status_out` array:
+ *
+ *  - \ref lwowOK: Device has been configured and verified
+ *  - \ref lwowERR: Device reports different configuration than requested
+ *  - \ref lwowERRCRC: Scratchpad CRC mismatch, device did not respond or data were corrupted
+ *  - Other member of \ref lwowr_t on communication error
+ *
+ * When alarm values are preserved, devices are processed in chunks of up to `32` devices,
+ * each chunk with its own copy, recall and verification.
+ *
+ * \note            Copy and recall are broadcast commands. Scratchpad-only changes of devices,
+ *                      not listed in `rom_ids` or not written due to read error, are saved to EEPROM as well
+ * \note            Devices in parasite power mode need strong pull-up during EEPROM write,
+ *                      which is not provided by this function
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       bits: Number of resolution bits. Possible values are `9 - 12`.
+ *                      Ignored by `DS18S20` devices
+ * \param[in]       temp_l: Alarm low temperature, see \ref lwow_ds18x20_set_alarm_temp_raw for possible values
+ * \param[in]       temp_h: Alarm high temperature, see \ref lwow_ds18x20_set_alarm_temp_raw for possible values
+ * \param[in]       rom_ids: Array of device addresses to verify.
+ *                      Can be set to `NULL` to skip verification, unless alarm temperatures are preserved
+ * \param[in]       cnt: Number of devices in `rom_ids` array
+ * \param[out]      status_out: Array of at least `cnt` elements to save status of each device to.
+ *                      Can be set to `NULL` if not used
+ * \return          \ref lwowOK if all devices have been configured and verified,
+ *                      \ref lwowERR if any device failed verification, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_ds18x20_configure_all_raw(lwow_t* const owobj, const uint8_t bits, int8_t temp_l, int8_t temp_h,
+                               const lwow_rom_t* const rom_ids, const size_t cnt, lwowr_t* const status_out) {
+    lwowr_t res, chunk_res;
+    uint8_t buff[4];
+    size_t len;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("bits >= 9U && bits <= 12U", bits >= 9U && bits <= 12U);
+    LWOW_ASSERT("rom_ids != NULL || cnt == 0", rom_ids != NULL || cnt == 0);
+
+    prv_alarm_limit(&temp_l, &temp_h);
+    buff[0] = LWOW_CMD_WSCRATCHPAD;
+    buff[1] = (uint8_t)temp_h;
+    buff[2] = (uint8_t)temp_l;
+    buff[3] = (uint8_t)(((bits - 9U) << 0x05U) | 0x1FU);
+    if (temp_l != LWOW_DS18X20_ALARM_NOCHANGE && temp_h != LWOW_DS18X20_ALARM_NOCHANGE) {
+        return prv_configure_devices(owobj, buff, temp_l, temp_h, rom_ids, cnt, status_out);
+    }
+
+    /* Devices are read before write, process them in chunks to track skipped devices */
+    LWOW_ASSERT("rom_ids != NULL", rom_ids != NULL);
+    res = lwowOK;
+    for (size_t i = 0; i < cnt; i += len) {
+        len = cnt - i > LWOW_DS18X20_PRESERVE_CHUNK ? LWOW_DS18X20_PRESERVE_CHUNK : cnt - i;
+        chunk_res = prv_configure_devices(owobj, buff, temp_l, temp_h, &rom_ids[i], len,
+                                          status_out != NULL ? &status_out[i] : NULL);
+        if (chunk_res == lwowERR) {
+            res = lwowERR;
+        } else if (chunk_res != lwowOK) {
+            return chunk_res;
+        }
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_configure_all_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_ds18x20_configure_all(lwow_t* const owobj, const uint8_t bits, int8_t temp_l, int8_t temp_h,
+                           const lwow_rom_t* const rom_ids, const size_t cnt, lwowr_t* const status_out) {
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    if ((res = lwow_protect(owobj, 1)) != lwowOK) {
+        return res;
+    }
+    res = lwow_ds18x20_configure_all_raw(owobj, bits, temp_l, temp_h, rom_ids, cnt, status_out);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
+/**
+ * \brief           Bring configuration of listed devices to requested values, writing only devices that differ
+ *
+ * EEPROM of all devices on the bus is recalled to scratchpad with single broadcast command first,
+ * hence pending scratchpad-only changes are discarded, also on devices not listed in `rom_ids`.
+ * Every listed device is then compared against requested resolution and alarm temperatures.
+ * Scratchpad is written and copied to EEPROM only when configuration differs,
+ * hence repeated calls with the same settings do not wear EEPROM.
+ *
+ * Per-device result is written to `status_out` array:
+ *
+ *  - \ref lwowOK: Device has requested configuration, either already or after write
+ *  - \ref lwowERRCRC: Scratchpad CRC mismatch, device did not respond or data were corrupted
+ *  - \ref lwowERR: EEPROM write did not complete in time
+ *  - Other member of \ref lwowr_t on communication error
+ *
+ * \note            Devices in parasite power mode need strong pull-up during EEPROM write,
+ *                      which is not provided by this function
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_ids: Array of device addresses to reconcile
+ * \param[in]       cnt: Number of devices in `rom_ids` array
+ * \param[in]       bits: Number of resolution bits. Possible values are `9 - 12`,
+ *                      or `0` to keep current resolution. Ignored by `DS18S20` devices
+ * \param[in]       temp_l: Alarm low temperature, see \ref lwow_ds18x20_set_alarm_temp_raw for possible values
+ * \param[in]       temp_h: Alarm high temperature, see \ref lwow_ds18x20_set_alarm_temp_raw for possible values
+ * \param[out]      changed_out: Array of at least `cnt` elements, set to `1` for devices that have been rewritten,
+ *                      `0` otherwise. Can be set to `NULL` if not used
+ * \param[out]      status_out: Array of at least `cnt` elements to save status of each device to.
+ *                      Can be set to `NULL` if not used
+ * \return          \ref lwowOK if all devices have requested configuration,
+ *                      \ref lwowERR if any device failed, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_ds18x20_reconcile_raw(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt, const uint8_t bits,
+                           int8_t temp_l, int8_t temp_h, uint8_t* const changed_out, lwowr_t* const status_out) {
+    lwowr_t res = lwowOK, dev_res;
+    uint8_t changed;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_ids != NULL", rom_ids != NULL);
+    LWOW_ASSERT("cnt > 0", cnt > 0);
+    LWOW_ASSERT("bits == 0 || (bits >= 9U && bits <= 12U)", bits == 0 || (bits >= 9U && bits <= 12U));
+
+    prv_alarm_limit(&temp_l, &temp_h);
+
+    /* Recall EEPROM of all devices, to compare against persistent configuration */
+    prv_cache_invalidate(owobj, NULL);
+    if ((res = lwow_reset_raw(owobj)) != lwowOK || (res = lwow_skip_rom_raw(owobj)) != lwowOK
+        || (res = lwow_write_byte_ex_raw(owobj, LWOW_CMD_RECEEPROM, NULL)) != lwowOK) {
+        return res;
+    }
+    if (!lwow_ds18x20_wait_done_raw(owobj, LWOW_DS18X20_EEPROM_WRITE_TIME)) {
+        return lwowERR;
+    }
+    prv_cache_set_synced(owobj, NULL, 1);
+    for (size_t i = 0; i < cnt; ++i) {
+        dev_res = prv_set_config(owobj, &rom_ids[i], bits, temp_l, temp_h, 1, 1, &changed);
+        if (dev_res != lwowOK && dev_res != lwowERR && dev_res != lwowERRCRC && dev_res != lwowERRPRESENCE) {
+            return dev_res; /* Low-level communication error, stop */
+        }
+        if (dev_res != lwowOK) {
+            res = lwowERR;
+        }
+        if (changed_out != NULL) {
+            changed_out[i] = changed;
+        }
+        if (status_out != NULL) {
+            status_out[i] = dev_res;
+        }
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_reconcile_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_ds18x20_reconcile(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt, const uint8_t bits,
+                       int8_t temp_l, int8_t temp_h, uint8_t* const changed_out, lwowr_t* const status_out) {
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    if ((res = lwow_protect(owobj, 1)) != lwowOK) {
+        return res;
+    }
+    res = lwow_ds18x20_reconcile_raw(owobj, rom_ids, cnt, bits, temp_l, temp_h, changed_out, status_out);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
 /**
  * \brief           Get the low and high temperature triggers for the alarm configuration
  * 
@@ -397,28 +1522,18 @@ lwow_ds18x20_set_alarm_temp(lwow_t* const owobj, const lwow_rom_t* const rom_id,
  */
 uint8_t
 lwow_ds18x20_get_alarm_temp_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t* temp_l, int8_t* temp_h) {
-    uint8_t res = 0, thigh = 0, tlow = 0;
+    uint8_t res = 0, cfg[3];
 
     LWOW_ASSERT0("owobj != NULL", owobj != NULL);
     LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
     LWOW_ASSERT0("temp_l != NULL || temp_h != NULL", temp_l != NULL || temp_h != NULL);
 
-    if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK) {
-        lwow_write_byte_ex_raw(owobj, LWOW_CMD_RSCRATCHPAD, NULL);
-
-        /* Read and ignore 2 bytes */
-        lwow_read_byte_ex_raw(owobj, &thigh);
-        lwow_read_byte_ex_raw(owobj, &thigh);
-
-        /* Read important data */
-        lwow_read_byte_ex_raw(owobj, &thigh);
-        lwow_read_byte_ex_raw(owobj, &tlow);
-
+    if (prv_get_config(owobj, rom_id, cfg)) {
         if (temp_l != NULL) {
-            *temp_l = (int8_t)tlow;
+            *temp_l = (int8_t)cfg[1];
         }
         if (temp_h != NULL) {
-            *temp_h = (int8_t)thigh;
+            *temp_h = (int8_t)cfg[0];
         }
         res = 1;
     }
@@ -437,12 +1552,74 @@ lwow_ds18x20_get_alarm_temp(lwow_t* const owobj, const lwow_rom_t* const rom_id,
     LWOW_ASSERT0("lwow_ds18x20_is_b(owobj, rom_id)", lwow_ds18x20_is_b(owobj, rom_id));
     LWOW_ASSERT0("temp_l != NULL || temp_h != NULL", temp_l != NULL || temp_h != NULL);
 
-    lwow_protect(owobj, 1);
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
     res = lwow_ds18x20_get_alarm_temp_raw(owobj, rom_id, temp_l, temp_h);
     lwow_unprotect(owobj, 1);
     return res;
 }
 
+/**
+ * \brief           Get power supply mode of device
+ *
+ * When \ref LWOW_CFG_DEV_CACHE_SIZE is enabled, result is cached and next calls do not access the bus
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address.
+ *                      Set to `NULL` to check if any device on the bus is in parasite power mode
+ * \return          \ref LWOW_DS18X20_POWER_EXTERNAL or \ref LWOW_DS18X20_POWER_PARASITE on success,
+ *                      \ref LWOW_DS18X20_POWER_UNKNOWN otherwise
+ */
+uint8_t
+lwow_ds18x20_get_power_supply_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint8_t res = LWOW_DS18X20_POWER_UNKNOWN, bit_val = 0;
+#if LWOW_CFG_DEV_CACHE_SIZE
+    lwow_dev_cache_t* entry;
+#endif /* LWOW_CFG_DEV_CACHE_SIZE */
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+#if LWOW_CFG_DEV_CACHE_SIZE
+    entry = prv_cache_get(owobj, rom_id, 0);
+    if (entry != NULL && (entry->flags & LWOW_DS18X20_CACHE_POWER)) {
+        return (entry->flags & LWOW_DS18X20_CACHE_PARASITE) ? LWOW_DS18X20_POWER_PARASITE
+                                                             : LWOW_DS18X20_POWER_EXTERNAL;
+    }
+#endif /* LWOW_CFG_DEV_CACHE_SIZE */
+
+    /* Parasite powered devices pull the line low during read slot */
+    if (lwow_reset_raw(owobj) == lwowOK && lwow_match_or_skip_rom_raw(owobj, rom_id) == lwowOK
+        && lwow_write_byte_ex_raw(owobj, LWOW_DS18X20_CMD_READ_POWER, NULL) == lwowOK
+        && lwow_read_bit_ex_raw(owobj, &bit_val) == lwowOK) {
+        res = bit_val ? LWOW_DS18X20_POWER_EXTERNAL : LWOW_DS18X20_POWER_PARASITE;
+#if LWOW_CFG_DEV_CACHE_SIZE
+        if ((entry = prv_cache_get(owobj, rom_id, 1)) != NULL) {
+            entry->flags |= LWOW_DS18X20_CACHE_POWER | (bit_val ? 0 : LWOW_DS18X20_CACHE_PARASITE);
+        }
+#endif /* LWOW_CFG_DEV_CACHE_SIZE */
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_ds18x20_get_power_supply_raw
+ * \note            This function is thread-safe
+ */
+uint8_t
+lwow_ds18x20_get_power_supply(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint8_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_get_power_supply_raw(owobj, rom_id);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
+
 /**
  * \brief           Search for `DS18x20` devices with alarm flag
  * \note            To reset search, use \ref lwow_search_reset function
@@ -465,7 +1642,9 @@ lwow_ds18x20_search_alarm(lwow_t* const owobj, lwow_rom_t* const rom_id) {
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
 
-    lwow_protect(owobj, 1);
+    if ((res = lwow_protect(owobj, 1)) != lwowOK) {
+        return res;
+    }
     res = lwow_ds18x20_search_alarm_raw(owobj, rom_id);
     lwow_unprotect(owobj, 1);
     return res;
@@ -525,3 +1704,45 @@ lwow_ds18x20_get_temp_conversion_time(uint8_t resolution, uint8_t is_b) {
         return 750U;
     }
 }
+
+/**
+ * \brief           Get temperature conversion time of specific device in units of milliseconds
+ *
+ * Resolution of `DS18B20` device is read with \ref lwow_ds18x20_get_resolution_raw,
+ * hence it is taken from the cache, when \ref LWOW_CFG_DEV_CACHE_SIZE is enabled
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \return          Conversion time in units of milliseconds on success, `0` otherwise
+ */
+uint16_t
+lwow_ds18x20_get_conversion_time_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint8_t resolution = 12U;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT0("rom_id != NULL", rom_id != NULL);
+
+    if (lwow_ds18x20_is_b(owobj, rom_id)) {
+        resolution = lwow_ds18x20_get_resolution_raw(owobj, rom_id);
+    }
+    return lwow_ds18x20_get_temp_conversion_time(resolution, lwow_ds18x20_is_b(owobj, rom_id));
+}
+
+/**
+ * \copydoc         lwow_ds18x20_get_conversion_time_raw
+ * \note            This function is thread-safe
+ */
+uint16_t
+lwow_ds18x20_get_conversion_time(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint16_t res = 0;
+
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT0("rom_id != NULL", rom_id != NULL);
+
+    if (lwow_protect(owobj, 1) != lwowOK) {
+        return 0;
+    }
+    res = lwow_ds18x20_get_conversion_time_raw(owobj, rom_id);
+    lwow_unprotect(owobj, 1);
+    return res;
+}
@@ -0,0 +1,184 @@
+/**
+ * \file            lwow_device_ds18x20_sampler.c
+ * \brief           DS18x20 pipelined sampling engine implementation
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "lwow/devices/lwow_device_ds18x20_sampler.h"
+#include "lwow/devices/lwow_device_ds18x20.h"
+#include "lwow/lwow.h"
+
+/* Bus cycle states */
+#define SAMPLER_STATE_START 0x00U /* Conversion is to be started */
+#define SAMPLER_STATE_WAIT  0x01U /* Waiting for conversion to finish */
+#define SAMPLER_STATE_READ  0x02U /* Reading sensors one by one */
+
+/**
+ * \brief           Start conversion on all sensors of the bus
+ * \param[in,out]   bus: Bus handle
+ * \param[in]       now: Current time in units of milliseconds
+ */
+static void
+prv_bus_start(lwow_ds18x20_sampler_bus_t* const bus, const uint32_t now) {
+    /* Failed start is reported with invalid samples after conversion time */
+    bus->started = lwow_ds18x20_start(bus->owobj, NULL);
+    bus->t_start = now;
+    bus->state = SAMPLER_STATE_WAIT;
+}
+
+/**
+ * \brief           Initialize sampling engine
+ * \param[out]      smp: Sampler handle
+ * \param[in]       fn: Sample callback function
+ * \param[in]       arg: Custom argument passed to callback function
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_ds18x20_sampler_init(lwow_ds18x20_sampler_t* const smp, lwow_ds18x20_sample_fn fn, void* arg) {
+    LWOW_ASSERT("smp != NULL", smp != NULL);
+    LWOW_ASSERT("fn != NULL", fn != NULL);
+
+    LWOW_MEMSET(smp, 0x00, sizeof(*smp));
+    smp->fn = fn;
+    smp->arg = arg;
+    return lwowOK;
+}
+
+/**
+ * \brief           Add bus with its sensors to the sampler
+ *
+ * Conversion time of the bus is set to the longest conversion time of its sensors,
+ * based on current resolution. Application may modify `conv_time` member afterwards.
+ *
+ * \param[in,out]   smp: Sampler handle
+ * \param[out]      bus: Bus handle, must stay valid while sampler is used
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       roms: Array of DS18x20 sensors on the bus, must stay valid while sampler is used
+ * \param[in]       roms_cnt: Number of sensors in array
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_ds18x20_sampler_add_bus(lwow_ds18x20_sampler_t* const smp, lwow_ds18x20_sampler_bus_t* const bus,
+                             lwow_t* const owobj, const lwow_rom_t* const roms, const size_t roms_cnt) {
+    lwow_ds18x20_sampler_bus_t** b;
+
+    LWOW_ASSERT("smp != NULL", smp != NULL);
+    LWOW_ASSERT("bus != NULL", bus != NULL);
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("roms != NULL", roms != NULL);
+    LWOW_ASSERT("roms_cnt > 0", roms_cnt > 0);
+
+    LWOW_MEMSET(bus, 0x00, sizeof(*bus));
+    bus->owobj = owobj;
+    bus->roms = roms;
+    bus->roms_cnt = roms_cnt;
+    bus->idx = smp->buses_cnt;
+    bus->state = SAMPLER_STATE_START;
+    for (size_t i = 0; i < roms_cnt; ++i) {
+        uint16_t conv_time = lwow_ds18x20_get_conversion_time(owobj, &roms[i]);
+
+        if (conv_time == 0) {
+            conv_time = lwow_ds18x20_get_temp_conversion_time(12U, 1U); /* Assume worst case */
+        }
+        if (conv_time > bus->conv_time) {
+            bus->conv_time = conv_time;
+        }
+    }
+
+    /* Add to the end of list to keep processing order */
+    for (b = &smp->buses; *b != NULL; b = &(*b)->next) {}
+    *b = bus;
+    ++smp->buses_cnt;
+    return lwowOK;
+}
+
+/**
+ * \brief           Process sampling engine
+ *
+ * Every bus is advanced by single step: conversion is started,
+ * its completion is checked or one sensor is read.
+ * Conversion on the bus is started again immediately after its last sensor has been read.
+ *
+ * \param[in,out]   smp: Sampler handle
+ * \param[in]       now: Current time in units of milliseconds, may wrap around
+ * \return          Time in units of milliseconds until next call is required.
+ *                      `0` means function shall be called again immediately
+ */
+uint32_t
+lwow_ds18x20_sampler_process(lwow_ds18x20_sampler_t* const smp, const uint32_t now) {
+    uint32_t next = UINT32_MAX;
+
+    LWOW_ASSERT0("smp != NULL", smp != NULL);
+
+    for (lwow_ds18x20_sampler_bus_t* bus = smp->buses; bus != NULL; bus = bus->next) {
+        if (bus->state == SAMPLER_STATE_START) {
+            prv_bus_start(bus, now);
+        }
+        if (bus->state == SAMPLER_STATE_WAIT) {
+            uint32_t elapsed = now - bus->t_start;
+
+            if (elapsed < bus->conv_time) {
+                if (bus->conv_time - elapsed < next) {
+                    next = bus->conv_time - elapsed;
+                }
+                continue;
+            }
+            bus->state = SAMPLER_STATE_READ;
+            bus->read_idx = 0;
+        }
+        if (bus->state == SAMPLER_STATE_READ) {
+            lwow_ds18x20_sample_t sample = {0};
+            int16_t temp = 0;
+
+            sample.bus_idx = bus->idx;
+            sample.rom = &bus->roms[bus->read_idx];
+            sample.timestamp = bus->t_start;
+            /* Scratchpad still holds previous value when conversion has not been started */
+            sample.valid = bus->started && lwow_ds18x20_read_fixed16(bus->owobj, sample.rom, &temp);
+            sample.temp_milli = lwow_ds18x20_fixed16_to_milli(temp);
+#if LWOW_CFG_FLOAT
+            sample.temp = (float)temp * 0.0625f;
+#endif /* LWOW_CFG_FLOAT */
+            smp->fn(&sample, smp->arg);
+            if (++bus->read_idx >= bus->roms_cnt) {
+                prv_bus_start(bus, now);
+                if (bus->conv_time < next) {
+                    next = bus->conv_time;
+                }
+            } else {
+                next = 0;
+            }
+        }
+    }
+    return next == UINT32_MAX ? 0 : next;
+}
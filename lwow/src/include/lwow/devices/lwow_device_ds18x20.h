@@ -56,15 +56,65 @@ extern "C" {
 #define LWOW_DS18X20_TEMP_MAX           ((int8_t)125)  /*!< Maximal temperature */
 #define LWOW_DS18X20_CMD_ALARM_SEARCH   0xEC           /*!< Alarm Search Command */
 #define LWOW_DS18X20_CMD_CONVERT_T      0x44           /*!< Convert T Command */
+#define LWOW_DS18X20_CMD_READ_POWER     0xB4           /*!< Read Power Supply Command */
+
+#define LWOW_DS18X20_POWER_UNKNOWN      0x00 /*!< Power supply mode is not known */
+#define LWOW_DS18X20_POWER_EXTERNAL     0x01 /*!< Device is powered from external supply */
+#define LWOW_DS18X20_POWER_PARASITE     0x02 /*!< Device is powered parasitically from data line */
+
+/**
+ * \brief           Data of single device, read with \ref lwow_ds18x20_read_ex_raw
+ */
+typedef struct {
+    int16_t temp_raw;      /*!< Content of temperature register, as read from device */
+    int32_t temp_milli;    /*!< Temperature in units of milli-degrees Celsius */
+#if LWOW_CFG_FLOAT || __DOXYGEN__
+    float temp;            /*!< Temperature in units of degrees Celsius.
+                                Available only when \ref LWOW_CFG_FLOAT is enabled */
+#endif                     /* LWOW_CFG_FLOAT || __DOXYGEN__ */
+    uint8_t resolution;    /*!< Resolution in units of bits, `9 - 12` */
+    int8_t alarm_h;        /*!< Alarm high temperature */
+    int8_t alarm_l;        /*!< Alarm low temperature */
+    uint8_t scratchpad[9]; /*!< Complete scratchpad content, including CRC byte */
+} lwow_ds18x20_data_t;
 
 uint8_t lwow_ds18x20_start_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 uint8_t lwow_ds18x20_start(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 
+uint8_t lwow_ds18x20_is_done_raw(lwow_t* const owobj);
+uint8_t lwow_ds18x20_is_done(lwow_t* const owobj);
+
+uint8_t lwow_ds18x20_wait_done_raw(lwow_t* const owobj, const uint32_t timeout);
+uint8_t lwow_ds18x20_wait_done(lwow_t* const owobj, const uint32_t timeout);
+
+uint8_t lwow_ds18x20_read_fixed16_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int16_t* const temp_out);
+uint8_t lwow_ds18x20_read_fixed16(lwow_t* const owobj, const lwow_rom_t* const rom_id, int16_t* const temp_out);
+
+uint8_t lwow_ds18x20_read_fixed_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int32_t* const temp_out);
+uint8_t lwow_ds18x20_read_fixed(lwow_t* const owobj, const lwow_rom_t* const rom_id, int32_t* const temp_out);
+
+int32_t lwow_ds18x20_fixed16_to_milli(int16_t temp);
+
+uint8_t lwow_ds18x20_read_ex_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id,
+                                 lwow_ds18x20_data_t* const data_out);
+uint8_t lwow_ds18x20_read_ex(lwow_t* const owobj, const lwow_rom_t* const rom_id, lwow_ds18x20_data_t* const data_out);
+
+size_t lwow_ds18x20_read_many_raw(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt,
+                                  int32_t* const temps_out, lwowr_t* const status_out);
+size_t lwow_ds18x20_read_many(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt,
+                              int32_t* const temps_out, lwowr_t* const status_out);
+
+#if LWOW_CFG_FLOAT || __DOXYGEN__
 uint8_t lwow_ds18x20_read_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, float* const temp_out);
 uint8_t lwow_ds18x20_read(lwow_t* const owobj, const lwow_rom_t* const rom_id, float* const temp_out);
+#endif /* LWOW_CFG_FLOAT || __DOXYGEN__ */
 
 uint8_t lwow_ds18x20_set_resolution_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits);
 uint8_t lwow_ds18x20_set_resolution(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits);
+uint8_t lwow_ds18x20_set_resolution_ex_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits,
+                                           const uint8_t persist);
+uint8_t lwow_ds18x20_set_resolution_ex(lwow_t* const owobj, const lwow_rom_t* const rom_id, const uint8_t bits,
+                                       const uint8_t persist);
 
 uint8_t lwow_ds18x20_get_resolution_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 uint8_t lwow_ds18x20_get_resolution(lwow_t* const owobj, const lwow_rom_t* const rom_id);
@@ -72,12 +122,33 @@ uint8_t lwow_ds18x20_get_resolution(lwow_t* const owobj, const lwow_rom_t* const
 uint8_t lwow_ds18x20_set_alarm_temp_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l,
                                         int8_t temp_h);
 uint8_t lwow_ds18x20_set_alarm_temp(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l, int8_t temp_h);
+uint8_t lwow_ds18x20_set_alarm_temp_ex_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l,
+                                           int8_t temp_h, const uint8_t persist);
+uint8_t lwow_ds18x20_set_alarm_temp_ex(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t temp_l,
+                                       int8_t temp_h, const uint8_t persist);
+
+uint8_t lwow_ds18x20_recall_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+uint8_t lwow_ds18x20_recall(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+
+lwowr_t lwow_ds18x20_configure_all_raw(lwow_t* const owobj, const uint8_t bits, int8_t temp_l, int8_t temp_h,
+                                       const lwow_rom_t* const rom_ids, const size_t cnt, lwowr_t* const status_out);
+lwowr_t lwow_ds18x20_configure_all(lwow_t* const owobj, const uint8_t bits, int8_t temp_l, int8_t temp_h,
+                                   const lwow_rom_t* const rom_ids, const size_t cnt, lwowr_t* const status_out);
+lwowr_t lwow_ds18x20_reconcile_raw(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt,
+                                   const uint8_t bits, int8_t temp_l, int8_t temp_h, uint8_t* const changed_out,
+                                   lwowr_t* const status_out);
+lwowr_t lwow_ds18x20_reconcile(lwow_t* const owobj, const lwow_rom_t* const rom_ids, const size_t cnt,
+                               const uint8_t bits, int8_t temp_l, int8_t temp_h, uint8_t* const changed_out,
+                               lwowr_t* const status_out);
 
 uint8_t lwow_ds18x20_get_alarm_temp_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t* temp_l,
                                         int8_t* temp_h);
 uint8_t lwow_ds18x20_get_alarm_temp(lwow_t* const owobj, const lwow_rom_t* const rom_id, int8_t* temp_l,
                                     int8_t* temp_h);
 
+uint8_t lwow_ds18x20_get_power_supply_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+uint8_t lwow_ds18x20_get_power_supply(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+
 lwowr_t lwow_ds18x20_search_alarm_raw(lwow_t* const owobj, lwow_rom_t* const rom_id);
 lwowr_t lwow_ds18x20_search_alarm(lwow_t* const owobj, lwow_rom_t* const rom_id);
 
@@ -85,6 +156,8 @@ uint8_t lwow_ds18x20_is_b(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 uint8_t lwow_ds18x20_is_s(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 
 uint16_t lwow_ds18x20_get_temp_conversion_time(uint8_t resolution, uint8_t is_b);
+uint16_t lwow_ds18x20_get_conversion_time_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+uint16_t lwow_ds18x20_get_conversion_time(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 
 /**
  * \}
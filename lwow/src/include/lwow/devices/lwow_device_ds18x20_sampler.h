@@ -0,0 +1,117 @@
+/**
+ * \file            lwow_device_ds18x20_sampler.h
+ * \brief           DS18x20 pipelined sampling engine header
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#ifndef LWOW_DEVICE_DS18x20_SAMPLER_HDR_H
+#define LWOW_DEVICE_DS18x20_SAMPLER_HDR_H
+
+#include "lwow/devices/lwow_device_ds18x20.h"
+#include "lwow/lwow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \ingroup         LWOW_DEVICES
+ * \defgroup        LWOW_DEVICE_DS18x20_SAMPLER DS18x20 sampling engine
+ * \brief           Continuous pipelined temperature sampling on multiple buses
+ * \{
+ *
+ * Every bus runs its own start, wait and read cycle.
+ * While one bus waits for temperature conversion to finish, sensors on other buses are read.
+ * Engine is cooperative and never sleeps, application calls \ref lwow_ds18x20_sampler_process
+ * with current time and may sleep for returned time before next call.
+ */
+
+/**
+ * \brief           Temperature sample
+ */
+typedef struct {
+    size_t bus_idx;        /*!< Index of the bus in order of addition to the sampler */
+    const lwow_rom_t* rom; /*!< Sensor ROM address */
+    int32_t temp_milli;    /*!< Temperature in milli-degrees Celsius, valid only when `valid` is set to `1` */
+#if LWOW_CFG_FLOAT || __DOXYGEN__
+    float temp;            /*!< Temperature in degrees Celsius, valid only when `valid` is set to `1`.
+                                Available only when \ref LWOW_CFG_FLOAT is enabled */
+#endif                     /* LWOW_CFG_FLOAT || __DOXYGEN__ */
+    uint8_t valid;         /*!< Set to `1` if temperature has been read successfully, `0` otherwise */
+    uint32_t timestamp;    /*!< Time of conversion start in units of milliseconds */
+} lwow_ds18x20_sample_t;
+
+/**
+ * \brief           Sample callback function
+ * \param[in]       sample: New sample
+ * \param[in]       arg: User argument, passed to \ref lwow_ds18x20_sampler_init function
+ */
+typedef void (*lwow_ds18x20_sample_fn)(const lwow_ds18x20_sample_t* sample, void* arg);
+
+/**
+ * \brief           Bus state in the sampler
+ */
+typedef struct lwow_ds18x20_sampler_bus {
+    lwow_t* owobj;                         /*!< 1-Wire handle */
+    const lwow_rom_t* roms;                /*!< Array of sensors on the bus */
+    size_t roms_cnt;                       /*!< Number of sensors on the bus */
+    size_t idx;                            /*!< Index of the bus in the sampler */
+    uint16_t conv_time;                    /*!< Conversion time in units of milliseconds */
+    uint8_t state;                         /*!< Current state of the bus cycle */
+    uint8_t started;                       /*!< Set to `1` if conversion has been started successfully */
+    size_t read_idx;                       /*!< Index of next sensor to read */
+    uint32_t t_start;                      /*!< Time of conversion start in units of milliseconds */
+    struct lwow_ds18x20_sampler_bus* next; /*!< Next bus in the sampler */
+} lwow_ds18x20_sampler_bus_t;
+
+/**
+ * \brief           Sampling engine
+ */
+typedef struct {
+    lwow_ds18x20_sampler_bus_t* buses; /*!< Linked list of buses */
+    size_t buses_cnt;                  /*!< Number of buses */
+    lwow_ds18x20_sample_fn fn;         /*!< Sample callback function */
+    void* arg;                         /*!< Callback user argument */
+} lwow_ds18x20_sampler_t;
+
+lwowr_t lwow_ds18x20_sampler_init(lwow_ds18x20_sampler_t* const smp, lwow_ds18x20_sample_fn fn, void* arg);
+lwowr_t lwow_ds18x20_sampler_add_bus(lwow_ds18x20_sampler_t* const smp, lwow_ds18x20_sampler_bus_t* const bus,
+                                     lwow_t* const owobj, const lwow_rom_t* const roms, const size_t roms_cnt);
+uint32_t lwow_ds18x20_sampler_process(lwow_ds18x20_sampler_t* const smp, const uint32_t now);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LWOW_DEVICE_DS18x20_SAMPLER_HDR_H */
@@ -61,9 +61,20 @@ typedef enum {
     lwowERRTXRX,     /*!< Error while exchanging data */
     lwowERRBAUD,     /*!< Error setting baudrate */
     lwowERRPAR,      /*!< Parameter error */
+    lwowERRCRC,      /*!< CRC check of received data failed */
+    lwowERRMEM,      /*!< Not enough memory to complete the operation */
+    lwowERRBUSY,     /*!< Instance is busy with another operation */
     lwowERR,         /*!< General-Purpose error */
 } lwowr_t;
 
+/**
+ * \brief           1-Wire bus speed
+ */
+typedef enum {
+    LWOW_SPEED_STANDARD = 0x00, /*!< Standard speed */
+    LWOW_SPEED_OVERDRIVE,       /*!< Overdrive speed */
+} lwow_speed_t;
+
 /**
  * \brief           ROM structure
  */
@@ -77,6 +88,13 @@ typedef struct {
  * \{
  */
 
+/**
+ * \brief           Exchange finished notification, called by low-level driver
+ * \param[in]       ctx: Context, passed to `tx_rx_start` function
+ * \param[in]       success: `1` if all bytes have been exchanged, `0` otherwise
+ */
+typedef void (*lwow_ll_done_fn)(void* ctx, uint8_t success);
+
 /**
  * \brief           1-Wire low-level driver structure
  */
@@ -119,28 +137,192 @@ typedef struct {
      * \return      `1` on success, `0` otherwise
      */
     uint8_t (*tx_rx)(const uint8_t* tx, uint8_t* rx, size_t len, void* arg);
+
+    /**
+     * \brief       Execute search ROM triplet in hardware (optional)
+     *
+     * Driver reads ROM bit and its complement, decides about direction and writes it back to the bus:
+     *
+     *  - If bit and its complement are different, direction is equal to bit value
+     *  - If both are `0` (collision), direction is equal to `dir` parameter
+     *  - If both are `1` (no device), direction is not relevant
+     *
+     * This is typically supported by bridge chips and adapters,
+     * that can generate complete triplet sequence on their own.
+     *
+     * \note        Set to `NULL` when not supported. Search is then performed with `tx_rx` function
+     * \param[in]   speed: Slot speed, member of \ref lwow_speed_t.
+     *                  Return `0` if speed is not supported, search pass is then repeated with `tx_rx` function
+     * \param[in]   dir: Direction to take in case of collision, either `1` or `0`
+     * \param[out]  id_bit: Output variable to write read bit value to, either `1` or `0`
+     * \param[out]  cmp_bit: Output variable to write read complement bit value to, either `1` or `0`
+     * \param[out]  dir_taken: Output variable to write direction sent to the bus, either `1` or `0`
+     * \param[in]   arg: Custom argument passed to \ref lwow_init function
+     * \return      `1` on success, `0` otherwise
+     */
+    uint8_t (*search_triplet)(uint8_t speed, uint8_t dir, uint8_t* id_bit, uint8_t* cmp_bit, uint8_t* dir_taken,
+                              void* arg);
+
+    /**
+     * \brief       Generate reset pulse and detect presence in hardware (optional)
+     *
+     * Driver may use break condition, dedicated timer or bridge command
+     * to generate reset pulse, instead of switching UART baudrate.
+     *
+     * \note        Set to `NULL` when not supported.
+     *                  Reset is then performed with `set_baudrate` and `tx_rx` functions
+     * \param[in]   speed: Reset speed, member of \ref lwow_speed_t.
+     *                  Return `0` if speed is not supported
+     * \param[out]  presence: Output variable to write presence status to.
+     *                  Set to `1` when at least one device responded, `0` otherwise
+     * \param[in]   arg: Custom argument passed to \ref lwow_init function
+     * \return      `1` on success, `0` otherwise
+     */
+    uint8_t (*reset)(uint8_t speed, uint8_t* presence, void* arg);
+
+    /**
+     * \brief       Start non-blocking exchange of bytes over UART hardware (optional)
+     *
+     * Function has the same semantics as `tx_rx`, but returns immediately after exchange started,
+     * for example with DMA or interrupts. `done_fn` must be called exactly once, when exchange finished,
+     * with `done_ctx` as parameter. It may be called from interrupt context or from within this function.
+     *
+     * Next exchange is prepared and started from `done_fn` context,
+     * hence `set_baudrate` and this function must be callable from that context and must not block.
+     * Native `reset` function is not used for transactions driven by this function,
+     * reset pulse is generated with `set_baudrate` and this function instead.
+     *
+     * \note        Used by asynchronous transactions only, when \ref LWOW_CFG_ASYNC is enabled.
+     *                  Set to `NULL` when not supported, `tx_rx` function is then used instead
+     * \param[in]   tx: Data to transmit over UART
+     * \param[out]  rx: Array to write received data to. It is the same memory as `tx`
+     * \param[in]   len: Number of bytes to exchange
+     * \param[in]   done_fn: Function to call when exchange finished
+     * \param[in]   done_ctx: Context to pass to `done_fn` function
+     * \param[in]   arg: Custom argument passed to \ref lwow_init function
+     * \return      `1` if exchange started, `0` otherwise
+     */
+    uint8_t (*tx_rx_start)(const uint8_t* tx, uint8_t* rx, size_t len, lwow_ll_done_fn done_fn, void* done_ctx,
+                           void* arg);
 } lwow_ll_drv_t;
 
 /**
  * \}
  */
 
+struct lwow;
+struct lwow_txn;
+
 /**
- * \brief           1-Wire structure
+ * \brief           Asynchronous transaction finished callback
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       res: Transaction result, \ref lwowOK on success, member of \ref lwowr_t otherwise
+ * \param[in]       arg: User argument, passed to \ref lwow_txn_execute_async function
+ */
+typedef void (*lwow_async_fn)(struct lwow* owobj, lwowr_t res, void* arg);
+
+#if LWOW_CFG_DEV_CACHE_SIZE || __DOXYGEN__
+
+/**
+ * \brief           Cached configuration of single device
+ *
+ * Meaning of `flags` and `data` is specific to device driver, that filled the entry
+ *
+ * \sa              LWOW_CFG_DEV_CACHE_SIZE
  */
 typedef struct {
-    lwow_rom_t rom;     /*!< ROM address of last device found.
+    lwow_rom_t rom;  /*!< Device ROM address */
+    uint8_t flags;   /*!< Device driver specific flags. Entry is not used when set to `0` */
+    uint8_t data[3]; /*!< Device driver specific data */
+} lwow_dev_cache_t;
+
+#endif /* LWOW_CFG_DEV_CACHE_SIZE || __DOXYGEN__ */
+
+/**
+ * \brief           1-Wire structure
+ */
+typedef struct lwow {
+    lwow_rom_t rom;            /*!< ROM address of last device found.
                                                      When searching for new devices, we always need last found address,
                                                      to be able to decide which way to go next time during scan. */
-    uint8_t disrepancy; /*!< Disrepancy value on last search */
-    void* arg;          /*!< User custom argument */
-
-    const lwow_ll_drv_t* ll_drv; /*!< Low-level functions driver */
+    uint8_t disrepancy;        /*!< Disrepancy value on last search */
+    uint8_t disrepancy_family; /*!< Disrepancy value within family code on last search */
+    void* arg;                 /*!< User custom argument */
+    uint32_t baud;             /*!< Currently configured baudrate of low-level driver. `0` when not known */
+    uint8_t speed;             /*!< Currently active bus speed, member of \ref lwow_speed_t */
+    uint8_t single_drop;       /*!< Set to `1` when single device is connected to the bus */
+#if LWOW_CFG_RESUME_ROM || __DOXYGEN__
+    lwow_rom_t resume_rom; /*!< ROM address of device, selected with last match or search ROM command */
+    uint8_t resume_valid;  /*!< Set to `1` when `resume_rom` is still selected for resume command */
+#endif                     /* LWOW_CFG_RESUME_ROM || __DOXYGEN__ */
+
+    const lwow_ll_drv_t* ll_drv;         /*!< Low-level functions driver */
+    struct lwow_txn* volatile async_txn; /*!< Pending asynchronous transaction, `NULL` when idle.
+                                                    Also set by event-driven executors, such as epoll reactor */
+#if LWOW_CFG_ASYNC || __DOXYGEN__
+    lwow_async_fn async_fn;                         /*!< Asynchronous transaction finished callback */
+    void* async_arg;                                /*!< Callback user argument */
+    uint8_t async_trx[8U * LWOW_CFG_TRX_BUFF_SIZE]; /*!< UART frame of current asynchronous exchange */
+    size_t async_len;                               /*!< Number of bytes in current asynchronous exchange */
+    volatile uint8_t async_state;                   /*!< Exchange hand-off state between caller and `done_fn` */
+    volatile uint8_t async_ok;                      /*!< Exchange status, reported within `tx_rx_start` */
+#endif                                              /* LWOW_CFG_ASYNC || __DOXYGEN__ */
+#if LWOW_CFG_DEV_CACHE_SIZE || __DOXYGEN__
+    lwow_dev_cache_t dev_cache[LWOW_CFG_DEV_CACHE_SIZE]; /*!< Configuration cache of devices on the bus */
+    size_t dev_cache_next;                               /*!< Index of next entry to replace when cache is full */
+#endif                                                   /* LWOW_CFG_DEV_CACHE_SIZE || __DOXYGEN__ */
 #if LWOW_CFG_OS || __DOXYGEN__
     LWOW_CFG_OS_MUTEX_HANDLE mutex; /*!< Mutex handle */
 #endif                              /* LWOW_CFG_OS || __DOXYGEN__ */
 } lwow_t;
 
+/**
+ * \brief           Transaction step type
+ */
+typedef enum {
+    LWOW_TXN_STEP_RESET = 0x00, /*!< Reset bus and check for presence */
+    LWOW_TXN_STEP_SELECT,       /*!< Select device with match ROM or all devices with skip ROM */
+    LWOW_TXN_STEP_WRITE,        /*!< Write bytes to the bus */
+    LWOW_TXN_STEP_READ,         /*!< Read bytes from the bus */
+    LWOW_TXN_STEP_CRC,          /*!< Check CRC-8 of previously read data */
+    LWOW_TXN_STEP_SEARCH,       /*!< Perform single search pass */
+} lwow_txn_step_type_t;
+
+/**
+ * \brief           Single transaction step
+ */
+typedef struct {
+    uint8_t type;   /*!< Step type, member of \ref lwow_txn_step_type_t */
+    uint8_t byt;    /*!< Inline byte value, used by single byte write step and as search step command */
+    size_t len;     /*!< Number of bytes exchanged in the step */
+    const void* tx; /*!< Data to write for write step, ROM to match for select step
+                            or data to check for CRC step */
+    void* rx;       /*!< Output data for read step or found ROM for search step */
+} lwow_txn_step_t;
+
+/**
+ * \brief           1-Wire transaction
+ *
+ * Transaction records sequence of bus operations, that are later executed
+ * in a single batch, with consecutive bit-slots merged into the fewest possible low-level calls.
+ *
+ * \note            Memory passed to steps must stay valid until transaction is executed
+ */
+typedef struct lwow_txn {
+    lwow_txn_step_t steps[LWOW_CFG_TXN_MAX_STEPS]; /*!< List of recorded steps */
+    size_t steps_cnt;                              /*!< Number of recorded steps */
+    size_t step_idx;                               /*!< Index of currently executed step */
+    size_t step_pos;                               /*!< Byte position (bit position for search) in current step */
+    uint8_t srch_disrepancy;                       /*!< Next disrepancy value of running search step */
+    uint8_t srch_disrepancy_family;                /*!< Next disrepancy value within family code of running search */
+    uint8_t srch_first;                            /*!< Set to `1` when running search step is the first search */
+    uint8_t srch_known;                            /*!< Number of leading bits following path of previous search */
+    uint8_t srch_batch;                            /*!< Number of known bits in current exchange */
+    uint8_t srch_read;                             /*!< Set to `1` when current exchange reads next unknown bit */
+    uint8_t srch_nobatch;                          /*!< Set to `1` to repeat search without known bits */
+    uint8_t srch_uart;                             /*!< Set to `1` to repeat search with UART slots */
+} lwow_txn_t;
+
 /**
  * \brief           Search callback function implementation
  * \param[in]       ow: 1-Wire handle
@@ -195,6 +377,8 @@ typedef lwowr_t (*lwow_search_cb_fn)(lwow_t* const owobj, const lwow_rom_t* cons
  */
 #define LWOW_ARRAYSIZE(x)      (sizeof(x) / sizeof((x)[0]))
 
+#define LWOW_TXN_TRX_LEN       (8U * LWOW_CFG_TRX_BUFF_SIZE) /*!< Length of UART frame for transaction exchange */
+
 #define LWOW_CMD_RSCRATCHPAD   0xBE /*!< Read scratchpad command for 1-Wire devices */
 #define LWOW_CMD_WSCRATCHPAD   0x4E /*!< Write scratchpad command for 1-Wire devices */
 #define LWOW_CMD_CPYSCRATCHPAD 0x48 /*!< Copy scratchpad command for 1-Wire devices */
@@ -204,6 +388,9 @@ typedef lwowr_t (*lwow_search_cb_fn)(lwow_t* const owobj, const lwow_rom_t* cons
 #define LWOW_CMD_READROM       0x33 /*!< Read ROM command */
 #define LWOW_CMD_MATCHROM      0x55 /*!< Match ROM command. Select device with specific ROM */
 #define LWOW_CMD_SKIPROM       0xCC /*!< Skip ROM, select all devices */
+#define LWOW_CMD_RESUME        0xA5 /*!< Resume command, select device addressed with last match or search ROM */
+#define LWOW_CMD_OD_SKIPROM    0x3C /*!< Overdrive skip ROM, select all devices and switch them to overdrive speed */
+#define LWOW_CMD_OD_MATCHROM   0x69 /*!< Overdrive match ROM, select device and switch it to overdrive speed */
 
 lwowr_t lwow_init(lwow_t* const owobj, const lwow_ll_drv_t* const ll_drv, void* arg);
 void lwow_deinit(lwow_t* const ow);
@@ -220,11 +407,21 @@ lwowr_t lwow_write_byte_ex(lwow_t* const owobj, const uint8_t btw, uint8_t* cons
 lwowr_t lwow_read_byte_ex_raw(lwow_t* const owobj, uint8_t* const byr);
 lwowr_t lwow_read_byte_ex(lwow_t* const owobj, uint8_t* const byr);
 
+lwowr_t lwow_write_bytes_ex_raw(lwow_t* const owobj, const void* const btw, void* const byr, const size_t len);
+lwowr_t lwow_write_bytes_ex(lwow_t* const owobj, const void* const btw, void* const byr, const size_t len);
+
+lwowr_t lwow_read_bytes_ex_raw(lwow_t* const owobj, void* const byr, const size_t len);
+lwowr_t lwow_read_bytes_ex(lwow_t* const owobj, void* const byr, const size_t len);
+
 lwowr_t lwow_read_bit_ex_raw(lwow_t* const owobj, uint8_t* const byr);
 lwowr_t lwow_read_bit_ex(lwow_t* const owobj, uint8_t* const byr);
 
 lwowr_t lwow_search_reset_raw(lwow_t* const ow);
 lwowr_t lwow_search_reset(lwow_t* const ow);
+lwowr_t lwow_search_set_family_raw(lwow_t* const owobj, const uint8_t family);
+lwowr_t lwow_search_set_family(lwow_t* const owobj, const uint8_t family);
+lwowr_t lwow_search_skip_family_raw(lwow_t* const owobj);
+lwowr_t lwow_search_skip_family(lwow_t* const owobj);
 
 lwowr_t lwow_search_raw(lwow_t* const owobj, lwow_rom_t* const rom_id);
 lwowr_t lwow_search(lwow_t* const owobj, lwow_rom_t* const rom_id);
@@ -246,10 +443,31 @@ lwowr_t lwow_search_devices_raw(lwow_t* const owobj, lwow_rom_t* const rom_id_ar
                                 size_t* const roms_found);
 lwowr_t lwow_search_devices(lwow_t* const owobj, lwow_rom_t* const rom_id_arr, const size_t rom_len,
                             size_t* const roms_found);
+lwowr_t lwow_verify_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+lwowr_t lwow_verify_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+lwowr_t lwow_verify_roms_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id_arr, const size_t rom_len,
+                             uint8_t* const present, size_t* const present_cnt);
+lwowr_t lwow_verify_roms(lwow_t* const owobj, const lwow_rom_t* const rom_id_arr, const size_t rom_len,
+                         uint8_t* const present, size_t* const present_cnt);
+lwowr_t lwow_search_devices_by_family_raw(lwow_t* const owobj, const uint8_t family, lwow_rom_t* const rom_id_arr,
+                                          const size_t rom_len, size_t* const roms_found);
+lwowr_t lwow_search_devices_by_family(lwow_t* const owobj, const uint8_t family, lwow_rom_t* const rom_id_arr,
+                                      const size_t rom_len, size_t* const roms_found);
 
 lwowr_t lwow_match_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 lwowr_t lwow_match_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 
+lwowr_t lwow_read_rom_raw(lwow_t* const owobj, lwow_rom_t* const rom_id);
+lwowr_t lwow_read_rom(lwow_t* const owobj, lwow_rom_t* const rom_id);
+lwowr_t lwow_set_single_drop(lwow_t* const owobj, const uint8_t single_drop);
+uint8_t lwow_is_single_drop(lwow_t* const owobj);
+
+lwowr_t lwow_od_skip_rom_raw(lwow_t* const owobj);
+lwowr_t lwow_od_skip_rom(lwow_t* const owobj);
+lwowr_t lwow_od_match_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+lwowr_t lwow_od_match_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id);
+uint8_t lwow_get_speed(lwow_t* const owobj);
+
 lwowr_t lwow_match_or_skip_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 lwowr_t lwow_match_or_skip_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id);
 
@@ -257,6 +475,28 @@ lwowr_t lwow_skip_rom_raw(lwow_t* const owobj);
 lwowr_t lwow_skip_rom(lwow_t* const owobj);
 
 uint8_t lwow_crc(const void* const in, const size_t len);
+uint8_t lwow_crc_update(uint8_t crc, const void* const in, size_t len);
+uint16_t lwow_crc16(const void* const in, const size_t len);
+uint16_t lwow_crc16_update(uint16_t crc, const void* const in, size_t len);
+uint8_t lwow_crc16_check_inv(uint16_t crc, const void* inv_crc);
+
+lwowr_t lwow_txn_init(lwow_txn_t* const txn);
+lwowr_t lwow_txn_add_reset(lwow_txn_t* const txn);
+lwowr_t lwow_txn_add_select(lwow_txn_t* const txn, const lwow_rom_t* const rom_id);
+lwowr_t lwow_txn_add_write(lwow_txn_t* const txn, const void* const btw, const size_t len);
+lwowr_t lwow_txn_add_write_byte(lwow_txn_t* const txn, const uint8_t btw);
+lwowr_t lwow_txn_add_read(lwow_txn_t* const txn, void* const byr, const size_t len);
+lwowr_t lwow_txn_add_crc_check(lwow_txn_t* const txn, const void* const data, const size_t len);
+lwowr_t lwow_txn_add_search(lwow_txn_t* const txn, const uint8_t cmd, lwow_rom_t* const rom_id);
+lwowr_t lwow_txn_start_raw(lwow_t* const owobj, lwow_txn_t* const txn);
+lwowr_t lwow_txn_prepare_raw(lwow_t* const owobj, lwow_txn_t* const txn, uint8_t* const trx, size_t* const len);
+lwowr_t lwow_txn_complete_raw(lwow_t* const owobj, lwow_txn_t* const txn, const uint8_t* const trx, const size_t len);
+lwowr_t lwow_txn_execute_raw(lwow_t* const owobj, lwow_txn_t* const txn);
+lwowr_t lwow_txn_execute(lwow_t* const owobj, lwow_txn_t* const txn);
+#if LWOW_CFG_ASYNC || __DOXYGEN__
+lwowr_t lwow_txn_execute_async(lwow_t* const owobj, lwow_txn_t* const txn, lwow_async_fn fn, void* arg);
+uint8_t lwow_txn_is_pending(lwow_t* const owobj);
+#endif /* LWOW_CFG_ASYNC || __DOXYGEN__ */
 
 /**
  * \}
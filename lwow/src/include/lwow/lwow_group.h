@@ -0,0 +1,119 @@
+/**
+ * \file            lwow_group.h
+ * \brief           Bus group executor header
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#ifndef LWOW_GROUP_HDR_H
+#define LWOW_GROUP_HDR_H
+
+#include "lwow/lwow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#if LWOW_CFG_GROUP || __DOXYGEN__
+
+/**
+ * \ingroup         LWOW
+ * \defgroup        LWOW_GROUP Bus group executor
+ * \brief           Execute work on multiple 1-Wire instances in parallel
+ * \{
+ *
+ * Group owns up to \ref LWOW_CFG_GROUP_MAX_BUSES 1-Wire instances
+ * and fixed pool of up to \ref LWOW_CFG_GROUP_MAX_WORKERS worker threads.
+ * Every bus is always processed by the same worker thread (`bus index % number of workers`),
+ * buses assigned to different workers are processed in parallel.
+ *
+ * Work function is called with instance already locked,
+ * hence it shall use functions with `_raw` suffix only.
+ */
+
+struct lwow_group;
+
+/**
+ * \brief           Work function, executed once for every bus in the group
+ * \param[in]       owobj: 1-Wire handle of the bus, already locked
+ * \param[in]       bus_idx: Index of the bus in the group
+ * \param[in]       arg: User argument, passed to \ref lwow_group_execute function
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+typedef lwowr_t (*lwow_group_work_fn)(lwow_t* const owobj, const size_t bus_idx, void* arg);
+
+/**
+ * \brief           Group worker thread
+ */
+typedef struct {
+    struct lwow_group* grp;          /*!< Group worker belongs to */
+    size_t idx;                      /*!< Worker index */
+    LWOW_CFG_OS_SEM_HANDLE sem_work; /*!< Semaphore, released when work is available */
+} lwow_group_worker_t;
+
+/**
+ * \brief           Bus group
+ */
+typedef struct lwow_group {
+    lwow_t buses[LWOW_CFG_GROUP_MAX_BUSES];                  /*!< 1-Wire instances */
+    lwowr_t status[LWOW_CFG_GROUP_MAX_BUSES];                /*!< Result of last work for each bus */
+    size_t buses_cnt;                                        /*!< Number of buses in the group */
+    lwow_group_worker_t workers[LWOW_CFG_GROUP_MAX_WORKERS]; /*!< Worker threads */
+    size_t workers_cnt;                                      /*!< Number of worker threads */
+    LWOW_CFG_OS_SEM_HANDLE sem_done;                         /*!< Semaphore, released by worker when finished */
+    LWOW_CFG_OS_MUTEX_HANDLE mutex;                          /*!< Mutex to allow single work at a time */
+    lwow_group_work_fn fn;                                   /*!< Current work function */
+    void* fn_arg;                                            /*!< Current work function argument */
+    uint8_t stop;                                            /*!< Set to `1` to stop worker threads */
+    void* arg;                                               /*!< User argument for system functions */
+} lwow_group_t;
+
+lwowr_t lwow_group_init(lwow_group_t* const grp, const size_t workers_cnt, void* arg);
+lwowr_t lwow_group_deinit(lwow_group_t* const grp);
+lwowr_t lwow_group_add_bus(lwow_group_t* const grp, const lwow_ll_drv_t* const ll_drv, void* arg,
+                           size_t* const bus_idx);
+lwow_t* lwow_group_get_bus(lwow_group_t* const grp, const size_t bus_idx);
+size_t lwow_group_get_bus_count(const lwow_group_t* const grp);
+
+lwowr_t lwow_group_execute(lwow_group_t* const grp, lwow_group_work_fn fn, void* arg, lwowr_t* const status,
+                           size_t* const ok_cnt);
+lwowr_t lwow_group_execute_txn(lwow_group_t* const grp, lwow_txn_t* const txns, lwowr_t* const status,
+                               size_t* const ok_cnt);
+
+/**
+ * \}
+ */
+
+#endif /* LWOW_CFG_GROUP || __DOXYGEN__ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LWOW_GROUP_HDR_H */
@@ -72,6 +72,208 @@ extern "C" {
 #define LWOW_CFG_OS_MUTEX_HANDLE void*
 #endif
 
+/**
+ * \brief           Semaphore handle type
+ *
+ * \note            This value must be set in case \ref LWOW_CFG_GROUP is set to `1`.
+ *                  If data type is not known to compiler, include header file with
+ *                  definition before you define handle type
+ */
+#ifndef LWOW_CFG_OS_SEM_HANDLE
+#define LWOW_CFG_OS_SEM_HANDLE void*
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` bus group executor
+ *
+ * Group executor drives multiple 1-Wire instances in parallel with fixed pool of worker threads.
+ *
+ * \note            \ref LWOW_CFG_OS must be enabled and system port must implement
+ *                  semaphore and thread functions
+ * \sa              lwow_group_t
+ */
+#ifndef LWOW_CFG_GROUP
+#define LWOW_CFG_GROUP 0
+#endif
+
+/**
+ * \brief           Maximum number of 1-Wire instances in single group
+ */
+#ifndef LWOW_CFG_GROUP_MAX_BUSES
+#define LWOW_CFG_GROUP_MAX_BUSES 8
+#endif
+
+/**
+ * \brief           Maximum number of worker threads in single group
+ */
+#ifndef LWOW_CFG_GROUP_MAX_WORKERS
+#define LWOW_CFG_GROUP_MAX_WORKERS 4
+#endif
+
+/**
+ * \brief           Stack size of group worker thread in units of bytes
+ *
+ * Used by system ports, where stack size must be provided on thread creation
+ */
+#ifndef LWOW_CFG_GROUP_THREAD_STACK_SIZE
+#define LWOW_CFG_GROUP_THREAD_STACK_SIZE 1024
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` automatic use of resume ROM command
+ *
+ * When enabled, library remembers last device selected with match or search ROM command.
+ * When the same device is selected again and no other device has been addressed in-between,
+ * resume command (`0xA5`, `8` slots) is sent instead of match ROM command (`72` slots)
+ *
+ * \note            All devices selected with \ref lwow_match_rom_raw must support resume command,
+ *                  which is not the case for DS18x20 temperature sensors.
+ *                  Devices must be addressed only with library functions for tracking to be valid
+ */
+#ifndef LWOW_CFG_RESUME_ROM
+#define LWOW_CFG_RESUME_ROM 0
+#endif
+
+/**
+ * \brief           Low-level baudrate used to generate reset pulse at overdrive speed
+ *
+ * Reset byte `0xF0` keeps the line low for `5` bit times (start bit and `4` zero bits),
+ * which must be within overdrive reset pulse range of `70-80us`,
+ * hence baudrate must be within `62500-71428` bauds.
+ * Presence pulse is sampled within `8-24us` after line is released.
+ *
+ * Default value gives `75us` reset pulse. Port, whose UART cannot generate it,
+ * may set other baudrate within the range
+ */
+#ifndef LWOW_CFG_OD_BAUD_RESET
+#define LWOW_CFG_OD_BAUD_RESET 66667
+#endif
+
+/**
+ * \brief           Low-level baudrate used for data slots at overdrive speed
+ *
+ * One UART byte represents single overdrive time slot, typically `6-16us` long
+ */
+#ifndef LWOW_CFG_OD_BAUD_DATA
+#define LWOW_CFG_OD_BAUD_DATA 1000000
+#endif
+
+/**
+ * \brief           CRC-8 calculation method
+ *
+ * Possible values:
+ *  - `0`: Bitwise calculation, no lookup table. Slowest, smallest flash footprint
+ *  - `1`: Single `256`-byte lookup table, one lookup per byte
+ *  - `4`: Slice-by-4 with `1024`-byte lookup tables, processes `4` bytes per iteration
+ *  - `8`: Slice-by-8 with `2048`-byte lookup tables, processes `8` bytes per iteration
+ *
+ * When set to non-zero value, CRC-16 calculation uses additional `512`-byte lookup table
+ */
+#ifndef LWOW_CFG_CRC_TABLE
+#define LWOW_CFG_CRC_TABLE 0
+#endif
+
+/**
+ * \brief           Maximum number of 1-Wire bytes exchanged in single low-level `tx_rx` call
+ *
+ * Multi-byte functions, such as \ref lwow_write_bytes_ex_raw, expand every 1-Wire byte
+ * to `8` UART bytes and exchange them all at once, to minimize number of driver calls.
+ *
+ * \note            Temporary buffer of `8 * LWOW_CFG_TRX_BUFF_SIZE` bytes is allocated on stack.
+ *                  Longer transfers are split to multiple exchanges
+ */
+#ifndef LWOW_CFG_TRX_BUFF_SIZE
+#define LWOW_CFG_TRX_BUFF_SIZE 16
+#endif
+
+/**
+ * \brief           Maximum number of steps in a single transaction
+ *
+ * \sa              lwow_txn_t
+ */
+#ifndef LWOW_CFG_TXN_MAX_STEPS
+#define LWOW_CFG_TXN_MAX_STEPS 8
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` asynchronous transaction execution
+ *
+ * When enabled, transactions can be started with \ref lwow_txn_execute_async
+ * and are executed in background with `tx_rx_start` low-level driver function.
+ * Every 1-Wire instance is extended with UART frame buffer of `8 * LWOW_CFG_TRX_BUFF_SIZE` bytes.
+ *
+ * \sa              lwow_ll_drv_t
+ */
+#ifndef LWOW_CFG_ASYNC
+#define LWOW_CFG_ASYNC 0
+#endif
+
+/**
+ * \brief           Maximum number of devices in single device registry
+ *
+ * Registry uses `8 + 1 + 1 + 4 = 14` bytes of memory per device (key, family, flags and user slot),
+ * plus hash index of `2` entries (`4` bytes) per device, `18` bytes per device in total.
+ * Value must not exceed `32767`
+ *
+ * \sa              lwow_registry_t
+ */
+#ifndef LWOW_CFG_REGISTRY_MAX_DEVICES
+#define LWOW_CFG_REGISTRY_MAX_DEVICES 32
+#endif
+
+/**
+ * \brief           Number of devices with cached configuration per 1-Wire instance
+ *
+ * Device drivers store configuration, read from devices, in the cache
+ * and answer later queries without bus traffic. Set to `0` to disable the cache.
+ * When cache is full, the oldest entry is replaced.
+ *
+ * Cache uses `12` bytes of memory per entry in every \ref lwow_t instance
+ *
+ * \note            Cache is valid only when devices are configured with library functions only
+ */
+#ifndef LWOW_CFG_DEV_CACHE_SIZE
+#define LWOW_CFG_DEV_CACHE_SIZE 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` floating point functions in device drivers
+ *
+ * When disabled, functions returning `float` values are not compiled,
+ * and fixed-point functions, such as \ref lwow_ds18x20_read_fixed_raw, must be used instead
+ */
+#ifndef LWOW_CFG_FLOAT
+#define LWOW_CFG_FLOAT 1
+#endif
+
+/**
+ * \brief           Maximum number of bytes read in single DS18x20 conversion poll
+ *
+ * \ref lwow_ds18x20_wait_done_raw polls conversion status with read time slots.
+ * Every unsuccessful poll doubles number of read slots for the next one,
+ * starting with `8` slots (`1` byte), up to `8 * LWOW_CFG_DS18X20_POLL_MAX_BYTES` slots.
+ * Higher value means fewer low-level driver calls during long conversions
+ *
+ * \note            Buffer of this size is allocated on stack.
+ *                  Values above \ref LWOW_CFG_TRX_BUFF_SIZE are split to multiple exchanges
+ */
+#ifndef LWOW_CFG_DS18X20_POLL_MAX_BYTES
+#define LWOW_CFG_DS18X20_POLL_MAX_BYTES LWOW_CFG_TRX_BUFF_SIZE
+#endif
+
+/**
+ * \brief           Time in units of milliseconds to sleep between DS18x20 conversion polls
+ *
+ * When set to non-zero value, \ref lwow_ds18x20_wait_done_raw calls \ref lwow_sys_delay between polls,
+ * which allows other threads (and other 1-Wire buses) to run while conversion is in progress.
+ * When set to `0`, polls are executed back-to-back.
+ *
+ * \note            \ref LWOW_CFG_OS must be enabled when this option is non-zero
+ */
+#ifndef LWOW_CFG_DS18X20_POLL_DELAY
+#define LWOW_CFG_DS18X20_POLL_DELAY 0
+#endif
+
 /**
  * \brief           Memory set function
  * 
@@ -90,6 +292,33 @@ extern "C" {
 #define LWOW_MEMCPY(dst, src, len) memcpy((dst), (src), (len))
 #endif
 
+/**
+ * \brief           Memory compare function
+ * 
+ * \note            Function footprint is the same as \ref memcmp
+ */
+#ifndef LWOW_MEMCMP
+#define LWOW_MEMCMP(s1, s2, len) memcmp((s1), (s2), (len))
+#endif
+
+/**
+ * \brief           Atomic compare-and-swap of `uint8_t` variable, used by asynchronous transactions
+ *
+ * When `*ptr` equals `expected`, it is set to `desired` and macro evaluates to non-zero value,
+ * otherwise it evaluates to `0`. Operation must be atomic against `done_fn` call
+ * of low-level driver (interrupt, another thread or core) and act as full memory barrier.
+ *
+ * Default implementation uses GCC builtin, also supported by Clang and ARM compiler 6.
+ * Override it with short critical section of the port, for example by disabling interrupts,
+ * when compiler does not support it
+ *
+ * 
+ote            Used only when \ref LWOW_CFG_ASYNC is enabled
+ */
+#ifndef LWOW_ASYNC_CAS
+#define LWOW_ASYNC_CAS(ptr, expected, desired) __sync_bool_compare_and_swap((ptr), (expected), (desired))
+#endif
+
 /**
  * \}
  */
@@ -0,0 +1,120 @@
+/**
+ * \file            lwow_registry.h
+ * \brief           Device registry header
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#ifndef LWOW_REGISTRY_HDR_H
+#define LWOW_REGISTRY_HDR_H
+
+#include "lwow/lwow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \ingroup         LWOW
+ * \defgroup        LWOW_REGISTRY Device registry
+ * \brief           Fixed-size registry of known devices with constant time ROM lookup
+ * \{
+ *
+ * Registry keeps data of every device in separate arrays (struct of arrays),
+ * indexed with device index from `0` to `count - 1`.
+ * Arrays may be accessed directly by the application, while devices are added and removed
+ * only with registry functions, that keep hash index up to date.
+ *
+ * \note            Registry functions are not thread-safe, except the ones accessing 1-Wire bus.
+ *                  Functions with `_raw` suffix do no implement
+ *                  locking mechanism when used with operating system.
+ */
+
+#define LWOW_REGISTRY_FLAG_PRESENT 0x01 /*!< Device responded during last verification or scan */
+#define LWOW_REGISTRY_FLAG_USER    0x10 /*!< First flag bit available to the application */
+
+/**
+ * \brief           Size of index table, number of hash slots
+ */
+#define LWOW_REGISTRY_INDEX_SIZE   (2U * (LWOW_CFG_REGISTRY_MAX_DEVICES))
+
+/**
+ * \brief           Size of serialized registry header in units of bytes
+ */
+#define LWOW_REGISTRY_BLOB_HDR_SIZE   8U
+
+/**
+ * \brief           Size of single serialized registry entry in units of bytes
+ */
+#define LWOW_REGISTRY_BLOB_ENTRY_SIZE 14U
+
+/**
+ * \brief           Size of memory needed to serialize registry with `n` devices
+ * \param[in]       n: Number of devices
+ */
+#define LWOW_REGISTRY_BLOB_SIZE(n)    (LWOW_REGISTRY_BLOB_HDR_SIZE + (size_t)(n) * LWOW_REGISTRY_BLOB_ENTRY_SIZE)
+
+/**
+ * \brief           Device registry
+ */
+typedef struct {
+    uint64_t key[LWOW_CFG_REGISTRY_MAX_DEVICES];   /*!< ROM address as 64-bit key, first ROM byte being LSB */
+    uint8_t family[LWOW_CFG_REGISTRY_MAX_DEVICES]; /*!< Family code of the device */
+    uint8_t flags[LWOW_CFG_REGISTRY_MAX_DEVICES];  /*!< Device flags, `LWOW_REGISTRY_FLAG_*` values */
+    uint32_t user[LWOW_CFG_REGISTRY_MAX_DEVICES];  /*!< User slot, free to use by the application */
+    uint16_t index[LWOW_REGISTRY_INDEX_SIZE]; /*!< Open-addressing hash index, `device index + 1` or `0` if empty */
+    size_t count;                             /*!< Number of devices in the registry */
+} lwow_registry_t;
+
+lwowr_t lwow_registry_init(lwow_registry_t* const reg);
+lwowr_t lwow_registry_add(lwow_registry_t* const reg, const lwow_rom_t* const rom_id, size_t* const idx);
+lwowr_t lwow_registry_find(const lwow_registry_t* const reg, const lwow_rom_t* const rom_id, size_t* const idx);
+lwowr_t lwow_registry_remove(lwow_registry_t* const reg, const lwow_rom_t* const rom_id);
+lwowr_t lwow_registry_get_rom(const lwow_registry_t* const reg, const size_t idx, lwow_rom_t* const rom_id);
+size_t lwow_registry_get_count(const lwow_registry_t* const reg);
+
+lwowr_t lwow_registry_save(const lwow_registry_t* const reg, void* const blob, const size_t blob_len,
+                           size_t* const used);
+lwowr_t lwow_registry_restore(lwow_registry_t* const reg, const void* const blob, const size_t blob_len,
+                              size_t* const skipped);
+
+lwowr_t lwow_registry_scan_raw(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const added);
+lwowr_t lwow_registry_scan(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const added);
+lwowr_t lwow_registry_verify_raw(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const present_cnt);
+lwowr_t lwow_registry_verify(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const present_cnt);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LWOW_REGISTRY_HDR_H */
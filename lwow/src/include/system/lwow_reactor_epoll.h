@@ -0,0 +1,121 @@
+/**
+ * \file            lwow_reactor_epoll.h
+ * \brief           Single-threaded epoll reactor for serial 1-Wire buses
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#ifndef LWOW_REACTOR_EPOLL_HDR_H
+#define LWOW_REACTOR_EPOLL_HDR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "lwow/lwow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \defgroup        LWOW_REACTOR_EPOLL Epoll reactor for Linux
+ * \brief           Drive many serial 1-Wire buses from single thread
+ * \{
+ *
+ * Every bus is a serial port (or pseudo-terminal), opened in non-blocking mode.
+ * Transactions run as resumable state machines: UART frame of the next exchange
+ * is written to the port and transaction resumes when epoll reports that all echoed bytes were received.
+ * While one bus waits for its UART, other buses are processed.
+ *
+ * Bus instance may also be used with regular blocking API, when no transaction is pending on it.
+ * While transaction is pending, thread-safe functions of the instance return \ref lwowERRBUSY.
+ * Reactor functions must be called from the same thread, that calls \ref lwow_reactor_run.
+ */
+
+struct epoll_event;
+struct lwow_reactor;
+struct lwow_reactor_bus;
+
+/**
+ * \brief           Transaction finished callback
+ * \param[in]       bus: Bus the transaction was executed on
+ * \param[in]       txn: Finished transaction
+ * \param[in]       res: Transaction result, \ref lwowOK on success, member of \ref lwowr_t otherwise
+ * \param[in]       arg: User argument, passed to \ref lwow_reactor_submit function
+ */
+typedef void (*lwow_reactor_done_fn)(struct lwow_reactor_bus* bus, lwow_txn_t* txn, lwowr_t res, void* arg);
+
+/**
+ * \brief           Serial bus, driven by the reactor
+ */
+typedef struct lwow_reactor_bus {
+    lwow_t ow;                     /*!< 1-Wire instance of the bus */
+    int fd;                        /*!< Serial port file descriptor */
+    struct lwow_reactor* reactor;  /*!< Reactor bus belongs to */
+    lwow_txn_t* txn;               /*!< Pending transaction, `NULL` when bus is idle */
+    lwow_reactor_done_fn done_fn;  /*!< Transaction finished callback */
+    void* done_arg;                /*!< Callback user argument */
+    uint8_t trx[LWOW_TXN_TRX_LEN]; /*!< UART frame of current exchange */
+    size_t len;                    /*!< Number of bytes in current exchange */
+    size_t tx_cnt;                 /*!< Number of bytes already written */
+    size_t rx_cnt;                 /*!< Number of bytes already received */
+    int64_t deadline;              /*!< Exchange timeout time in units of milliseconds */
+    uint8_t hangup;                /*!< Set to `1` when port has been hung up and is no longer watched */
+    struct lwow_reactor_bus* next; /*!< Next bus in the reactor */
+} lwow_reactor_bus_t;
+
+/**
+ * \brief           Reactor
+ */
+typedef struct lwow_reactor {
+    int epfd;                  /*!< Epoll file descriptor */
+    lwow_reactor_bus_t* buses; /*!< Linked list of buses */
+    size_t pending;            /*!< Number of pending transactions */
+    uint32_t timeout;          /*!< Timeout of single exchange in units of milliseconds */
+    struct epoll_event* evs;   /*!< Events being processed by \ref lwow_reactor_run, `NULL` outside of it */
+    size_t evs_cnt;            /*!< Number of events being processed */
+} lwow_reactor_t;
+
+lwowr_t lwow_reactor_init(lwow_reactor_t* const r, const uint32_t timeout);
+lwowr_t lwow_reactor_deinit(lwow_reactor_t* const r);
+lwowr_t lwow_reactor_add_bus(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus, const int fd);
+lwowr_t lwow_reactor_open_bus(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus, const char* const path);
+lwowr_t lwow_reactor_remove_bus(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus);
+lwowr_t lwow_reactor_submit(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus, lwow_txn_t* const txn,
+                            lwow_reactor_done_fn done_fn, void* done_arg);
+lwowr_t lwow_reactor_run(lwow_reactor_t* const r, const int timeout, size_t* const pending);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LWOW_REACTOR_EPOLL_HDR_H */
@@ -82,6 +82,80 @@ uint8_t lwow_sys_mutex_wait(LWOW_CFG_OS_MUTEX_HANDLE* mutex, void* arg);
  */
 uint8_t lwow_sys_mutex_release(LWOW_CFG_OS_MUTEX_HANDLE* mutex, void* arg);
 
+#if LWOW_CFG_GROUP || __DOXYGEN__
+
+/**
+ * \brief           Thread function prototype
+ * \param[in]       thread_arg: Argument passed to \ref lwow_sys_thread_create function
+ */
+typedef void (*lwow_sys_thread_fn)(void* thread_arg);
+
+/**
+ * \brief           Create a new counting semaphore and assign value to handle
+ * \note            Function is required only when \ref LWOW_CFG_GROUP is enabled
+ * \param[in]       sem: Output variable to save semaphore handle
+ * \param[in]       cnt: Initial count of semaphore
+ * \param[in]       arg: User argument passed on \ref lwow_group_init function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t lwow_sys_sem_create(LWOW_CFG_OS_SEM_HANDLE* sem, uint8_t cnt, void* arg);
+
+/**
+ * \brief           Delete existing semaphore and invalidate semaphore variable
+ * \note            Function is required only when \ref LWOW_CFG_GROUP is enabled
+ * \param[in]       sem: Semaphore handle to remove and invalidate
+ * \param[in]       arg: User argument passed on \ref lwow_group_init function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t lwow_sys_sem_delete(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg);
+
+/**
+ * \brief           Wait for a semaphore until available (unlimited time)
+ * \note            Function is required only when \ref LWOW_CFG_GROUP is enabled
+ * \param[in]       sem: Semaphore handle to wait for
+ * \param[in]       arg: User argument passed on \ref lwow_group_init function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t lwow_sys_sem_wait(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg);
+
+/**
+ * \brief           Release semaphore, increase its count
+ * \note            Function is required only when \ref LWOW_CFG_GROUP is enabled
+ * \param[in]       sem: Semaphore handle to release
+ * \param[in]       arg: User argument passed on \ref lwow_group_init function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t lwow_sys_sem_release(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg);
+
+/**
+ * \brief           Create and start a new thread
+ *
+ * Thread must be terminated and its resources released by the port,
+ * when `thread_fn` function returns
+ *
+ * \note            Function is required only when \ref LWOW_CFG_GROUP is enabled
+ * \param[in]       thread_fn: Thread function
+ * \param[in]       thread_arg: Argument passed to thread function
+ * \param[in]       arg: User argument passed on \ref lwow_group_init function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t lwow_sys_thread_create(lwow_sys_thread_fn thread_fn, void* thread_arg, void* arg);
+
+#endif /* LWOW_CFG_GROUP || __DOXYGEN__ */
+
+#if LWOW_CFG_DS18X20_POLL_DELAY || __DOXYGEN__
+
+/**
+ * \brief           Put current thread to sleep for specific time
+ * \note            Function is required only when \ref LWOW_CFG_DS18X20_POLL_DELAY is non-zero
+ * \param[in]       ms: Time to sleep in units of milliseconds
+ * \param[in]       arg: User argument passed on \ref lwow_init function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t lwow_sys_delay(uint32_t ms, void* arg);
+
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY || __DOXYGEN__ */
+
 /**
  * \}
  */
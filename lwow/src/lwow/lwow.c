@@ -37,22 +37,100 @@
 #include "lwow/lwow.h"
 #include "system/lwow_sys.h"
 
+#if LWOW_CFG_CRC_TABLE != 0 && LWOW_CFG_CRC_TABLE != 1 && LWOW_CFG_CRC_TABLE != 4 && LWOW_CFG_CRC_TABLE != 8
+#error "LWOW_CFG_CRC_TABLE must be set to 0, 1, 4 or 8"
+#endif /* LWOW_CFG_CRC_TABLE */
+
 #if !__DOXYGEN__
 
 /* Internal macros */
 #define OW_FIRST_DEV  0xFF
 #define OW_LAST_DEV   0x00
+#define OW_FAMILY_MIN 57 /* Lowest id bit number of family code byte */
 
 #define OW_RESET_BYTE 0xF0
+#define OW_BAUD_RESET 9600U
+#define OW_BAUD_DATA  115200U
 
 #endif /* !__DOXYGEN__ */
 
+/* Get bit value from ROM address, position 0 being LSB bit of first byte */
+#define ROM_BIT_GET(rom, pos) (uint8_t)(((rom)[(pos) >> 0x03U] >> ((pos) & 0x07U)) & 0x01U)
+
 /* Set value if not NULL */
 #define SET_NOT_NULL(p, v)                                                                                             \
     if ((p) != NULL) {                                                                                                 \
         *(p) = (v);                                                                                                    \
     }
 
+/**
+ * \brief           Set baudrate of low-level driver, if not already set
+ * \param[in]       owobj: OneWire instance
+ * \param[in]       baud: Baudrate to set
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_set_baudrate(lwow_t* const owobj, const uint32_t baud) {
+    if (owobj->baud != baud) {
+        if (!owobj->ll_drv->set_baudrate(baud, owobj->arg)) {
+            owobj->baud = 0; /* Baudrate is in unknown state */
+            return lwowERRBAUD;
+        }
+        owobj->baud = baud;
+    }
+    return lwowOK;
+}
+
+/**
+ * \brief           Exchange bit-slots with low-level driver
+ *
+ * Baudrate for data slots is set here, rather than after reset,
+ * to avoid reconfiguration of the hardware between consecutive resets
+ *
+ * \param[in]       owobj: OneWire instance
+ * \param[in]       tx: UART bytes to transmit
+ * \param[out]      rx: Array to write received UART bytes to
+ * \param[in]       len: Number of bytes to exchange
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_tx_rx(lwow_t* const owobj, const uint8_t* tx, uint8_t* rx, size_t len) {
+    lwowr_t res;
+
+    if ((res = prv_set_baudrate(owobj, owobj->speed == LWOW_SPEED_OVERDRIVE ? LWOW_CFG_OD_BAUD_DATA : OW_BAUD_DATA))
+        != lwowOK) {
+        return res;
+    }
+    if (!owobj->ll_drv->tx_rx(tx, rx, len, owobj->arg)) {
+        return lwowERRTXRX;
+    }
+    return lwowOK;
+}
+
+/**
+ * \brief           Update ROM address of the device, selected for resume command
+ *
+ * Device remains selected for resume after match ROM or search ROM command,
+ * until another device is addressed or skip ROM command is sent
+ *
+ * \param[in]       owobj: OneWire instance
+ * \param[in]       rom: Selected device ROM address or `NULL` to invalidate it
+ */
+static void
+prv_resume_update(lwow_t* const owobj, const uint8_t* rom) {
+#if LWOW_CFG_RESUME_ROM
+    if (rom != NULL) {
+        LWOW_MEMCPY(owobj->resume_rom.rom, rom, sizeof(owobj->resume_rom.rom));
+        owobj->resume_valid = 1;
+    } else {
+        owobj->resume_valid = 0;
+    }
+#else  /* LWOW_CFG_RESUME_ROM */
+    (void)owobj;
+    (void)rom;
+#endif /* !LWOW_CFG_RESUME_ROM */
+}
+
 /**
  * \brief           Send single bit to OneWire port
  * \param[in]       owobj: OneWire instance
@@ -62,6 +140,7 @@
  */
 static lwowr_t
 prv_send_bit(lwow_t* const owobj, uint8_t btw, uint8_t* btr) {
+    lwowr_t res;
     uint8_t byt = 0;
 
     SET_NOT_NULL(btr, 0);
@@ -71,14 +150,69 @@ prv_send_bit(lwow_t* const owobj, uint8_t btw, uint8_t* btr) {
      * To send logical 0 over 1-wire, send 0x00 over UART
      */
     btw = btw > 0 ? 0xFFU : 0x00U; /* Convert to 0 or 1 */
-    if (!owobj->ll_drv->tx_rx(&btw, &byt, 1U, owobj->arg)) {
-        return lwowERRTXRX; /* Transmit error */
+    if ((res = prv_tx_rx(owobj, &btw, &byt, 1U)) != lwowOK) {
+        return res; /* Transmit error */
     }
     byt = byt == 0xFFU ? 1U : 0U; /* Go to bit values */
     SET_NOT_NULL(btr, byt);       /* Set new byte */
     return lwowOK;
 }
 
+/**
+ * \brief           Exchange multiple bytes over OneWire port
+ *
+ * Bytes are expanded to UART bytes (one per bit) and exchanged
+ * with single low-level call, up to \ref LWOW_CFG_TRX_BUFF_SIZE bytes at a time
+ *
+ * \param[in]       owobj: OneWire instance
+ * \param[in]       btw: Bytes to write. Set to `NULL` to write `0xFF` for each byte (read operation)
+ * \param[out]      byr: Output array to write read bytes to. Set to `NULL` if not used.
+ *                      It may point to the same memory as `btw`
+ * \param[in]       len: Number of bytes to exchange
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_exchange_bytes(lwow_t* const owobj, const uint8_t* btw, uint8_t* byr, size_t len) {
+    uint8_t trx[8U * LWOW_CFG_TRX_BUFF_SIZE];
+    lwowr_t res;
+
+    while (len > 0) {
+        size_t chunk = len > LWOW_CFG_TRX_BUFF_SIZE ? LWOW_CFG_TRX_BUFF_SIZE : len;
+
+        /* Prepare output data, 0xFF for logical 1 and 0x00 for logical 0 */
+        for (size_t idx = 0; idx < chunk; ++idx) {
+            uint8_t byt = btw != NULL ? btw[idx] : 0xFFU;
+            for (uint8_t i = 0; i < 8U; ++i) {
+                trx[8U * idx + i] = (byt & (1U << i)) ? 0xFFU : 0x00U;
+            }
+        }
+
+        /* Exchange all bytes at once */
+        if ((res = prv_tx_rx(owobj, trx, trx, 8U * chunk)) != lwowOK) {
+            return res;
+        }
+
+        /* Decode received data */
+        if (byr != NULL) {
+            for (size_t idx = 0; idx < chunk; ++idx) {
+                uint8_t tmp = 0U;
+                for (uint8_t i = 0; i < 8U; ++i) {
+                    if (trx[8U * idx + i] == 0xFFU) {
+                        tmp |= 0x01U << i;
+                    }
+                }
+                byr[idx] = tmp;
+            }
+            byr += chunk;
+        }
+        if (btw != NULL) {
+            btw += chunk;
+        }
+        len -= chunk;
+    }
+    return lwowOK;
+}
+
 /**
  * \brief           Initialize OneWire instance
  * \param[in]       owobj: OneWire instance
@@ -96,6 +230,15 @@ lwow_init(lwow_t* const owobj, const lwow_ll_drv_t* const ll_drv, void* arg) {
     LWOW_ASSERT("ll_drv->tx_rx != NULL", ll_drv->tx_rx != NULL);
 
     owobj->arg = arg;
+    owobj->baud = 0;                        /* Baudrate is not known until first exchange */
+    owobj->speed = LWOW_SPEED_STANDARD;     /* Start at standard speed */
+    prv_resume_update(owobj, NULL);         /* No device selected */
+    owobj->single_drop = 0;                 /* Number of devices is not known yet */
+    owobj->async_txn = NULL;                /* No pending transaction */
+#if LWOW_CFG_DEV_CACHE_SIZE
+    LWOW_MEMSET(owobj->dev_cache, 0x00, sizeof(owobj->dev_cache)); /* Nothing is cached yet */
+    owobj->dev_cache_next = 0;
+#endif                                      /* LWOW_CFG_DEV_CACHE_SIZE */
     owobj->ll_drv = ll_drv;                 /* Assign low-level driver */
     if (!owobj->ll_drv->init(owobj->arg)) { /* Init low-level directly */
         return lwowERR;
@@ -127,10 +270,15 @@ lwow_deinit(lwow_t* const owobj) {
 
 /**
  * \brief           Protect 1-wire from concurrent access
- * \note            Used only for OS systems
+ *
+ * When asynchronous transaction is pending, instance stays busy until it finishes
+ * and function fails without protection being held.
+ *
+ * \note            Mutex is used only for OS systems
  * \param[in,out]   owobj: 1-Wire handle
  * \param[in]       protect: Set to `1` to protect core, `0` otherwise
- * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ * \return          \ref lwowOK on success, \ref lwowERRBUSY if asynchronous transaction is pending,
+ *                      member of \ref lwowr_t otherwise
  */
 lwowr_t
 lwow_protect(lwow_t* const owobj, const uint8_t protect) {
@@ -140,10 +288,11 @@ lwow_protect(lwow_t* const owobj, const uint8_t protect) {
     if (protect && !lwow_sys_mutex_wait(&owobj->mutex, owobj->arg)) {
         return lwowERR;
     }
-#else
-    (void)owobj;
-    (void)protect;
 #endif /* LWOW_CFG_OS */
+    if (protect && owobj->async_txn != NULL) {
+        lwow_unprotect(owobj, protect);
+        return lwowERRBUSY;
+    }
     return lwowOK;
 }
 
@@ -171,27 +320,38 @@ lwow_unprotect(lwow_t* const owobj, const uint8_t protect) {
 }
 
 /**
- * \brief           Reset 1-Wire bus and set connected devices to idle state
+ * \brief           Generate reset pulse at selected speed and check for presence
  * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       speed: Reset speed, member of \ref lwow_speed_t
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
-lwowr_t
-lwow_reset_raw(lwow_t* const owobj) {
+static lwowr_t
+prv_reset(lwow_t* const owobj, uint8_t speed) {
+    lwowr_t res;
     uint8_t byt = 0;
 
-    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    /* Use native reset operation, if supported by the driver */
+    if (owobj->ll_drv->reset != NULL) {
+        if (!owobj->ll_drv->reset(speed, &byt, owobj->arg)) {
+            return lwowERRTXRX; /* Error with reset operation */
+        }
+        return byt ? lwowOK : lwowERRPRESENCE;
+    }
 
-    /* First send reset pulse */
+    /*
+     * First send reset pulse.
+     *
+     * Baudrate is set back to data slots speed on next exchange,
+     * hence consecutive resets do not reconfigure the hardware
+     */
     byt = OW_RESET_BYTE; /* Set reset sequence byte = 0xF0 */
-    if (!owobj->ll_drv->set_baudrate(9600U, owobj->arg)) {
-        return lwowERRBAUD; /* Error setting baudrate */
+    if ((res = prv_set_baudrate(owobj, speed == LWOW_SPEED_OVERDRIVE ? LWOW_CFG_OD_BAUD_RESET : OW_BAUD_RESET))
+        != lwowOK) {
+        return res; /* Error setting baudrate */
     }
     if (!owobj->ll_drv->tx_rx(&byt, &byt, 1U, owobj->arg)) {
         return lwowERRTXRX; /* Error with data exchange */
     }
-    if (!owobj->ll_drv->set_baudrate(115200U, owobj->arg)) {
-        return lwowERRBAUD; /* Error setting baudrate */
-    }
 
     /* Check if there is reply from any device */
     if (byt == 0 || byt == OW_RESET_BYTE) {
@@ -200,6 +360,34 @@ lwow_reset_raw(lwow_t* const owobj) {
     return lwowOK;
 }
 
+/**
+ * \brief           Reset 1-Wire bus and set connected devices to idle state
+ *
+ * Reset is generated at currently active speed.
+ * When reset at overdrive speed fails, instance falls back to standard speed
+ * and repeats the reset, which also returns all devices to standard speed
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reset_raw(lwow_t* const owobj) {
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    res = prv_reset(owobj, owobj->speed);
+    if (res != lwowOK && owobj->speed == LWOW_SPEED_OVERDRIVE) {
+        owobj->speed = LWOW_SPEED_STANDARD;
+        prv_resume_update(owobj, NULL);
+        res = prv_reset(owobj, LWOW_SPEED_STANDARD);
+    }
+    if (res != lwowOK) {
+        prv_resume_update(owobj, NULL); /* Devices might have been removed */
+    }
+    return res;
+}
+
 /**
  * \copydoc         lwow_reset_raw
  * \note            This function is thread-safe
@@ -210,7 +398,9 @@ lwow_reset(lwow_t* const owobj) {
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
 
-    lwow_protect(owobj, 1U);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
     res = lwow_reset_raw(owobj);
     lwow_unprotect(owobj, 1U);
     return res;
@@ -226,6 +416,7 @@ lwow_reset(lwow_t* const owobj) {
 lwowr_t
 lwow_write_byte_ex_raw(lwow_t* const owobj, const uint8_t btw, uint8_t* const byr) {
     uint8_t trx[8];
+    lwowr_t res;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
     SET_NOT_NULL(byr, 0);
@@ -243,8 +434,8 @@ lwow_write_byte_ex_raw(lwow_t* const owobj, const uint8_t btw, uint8_t* const by
      * Exchange data on UART level,
      * send single byte for each bit = 8 bytes
      */
-    if (!owobj->ll_drv->tx_rx(trx, trx, 8U, owobj->arg)) {
-        return lwowERRTXRX;
+    if ((res = prv_tx_rx(owobj, trx, trx, 8U)) != lwowOK) {
+        return res;
     }
 
     /* Update output value */
@@ -275,7 +466,9 @@ lwow_write_byte_ex(lwow_t* const owobj, const uint8_t btw, uint8_t* const byr) {
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
 
-    lwow_protect(owobj, 1U);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
     res = lwow_write_byte_ex_raw(owobj, btw, byr);
     lwow_unprotect(owobj, 1U);
     return res;
@@ -312,492 +505,2323 @@ lwow_read_byte_ex(lwow_t* const owobj, uint8_t* const byr) {
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
     LWOW_ASSERT("byr != NULL", byr != NULL);
 
-    lwow_protect(owobj, 1U);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
     res = lwow_read_byte_ex_raw(owobj, byr);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Read sinle bit from OW device
+ * \brief           Write multiple bytes over OW and read their response
+ *
+ * All bytes are exchanged with minimum number of low-level calls,
+ * as defined by \ref LWOW_CFG_TRX_BUFF_SIZE configuration
+ *
  * \param[in,out]   owobj: 1-Wire handle
- * \param[out]      br: Pointer to save read value, either `1` or `0`
+ * \param[in]       btw: Array of bytes to write
+ * \param[out]      byr: Array to write read values to. Set to `NULL` if not used.
+ *                      It may point to the same memory as `btw`
+ * \param[in]       len: Number of bytes to write
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_read_bit_ex_raw(lwow_t* const owobj, uint8_t* const byr) {
+lwow_write_bytes_ex_raw(lwow_t* const owobj, const void* const btw, void* const byr, const size_t len) {
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("byr != NULL", byr != NULL);
+    LWOW_ASSERT("btw != NULL", btw != NULL);
+    LWOW_ASSERT("len > 0", len > 0);
 
-    /* Send bit as `1` and read the response */
-    return prv_send_bit(owobj, 1, byr);
+    return prv_exchange_bytes(owobj, btw, byr, len);
 }
 
 /**
- * \copydoc         lwow_read_bit_ex_raw
+ * \copydoc         lwow_write_bytes_ex_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_read_bit_ex(lwow_t* const owobj, uint8_t* const byr) {
+lwow_write_bytes_ex(lwow_t* const owobj, const void* const btw, void* const byr, const size_t len) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("byr != NULL", byr != NULL);
+    LWOW_ASSERT("btw != NULL", btw != NULL);
+    LWOW_ASSERT("len > 0", len > 0);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_read_bit_ex_raw(owobj, byr);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_write_bytes_ex_raw(owobj, btw, byr, len);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Reset search
+ * \brief           Read multiple bytes from OW device
+ *
+ * All bytes are exchanged with minimum number of low-level calls,
+ * as defined by \ref LWOW_CFG_TRX_BUFF_SIZE configuration
+ *
  * \param[in,out]   owobj: 1-Wire handle
+ * \param[out]      byr: Array to save read values to
+ * \param[in]       len: Number of bytes to read
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_search_reset_raw(lwow_t* const owobj) {
+lwow_read_bytes_ex_raw(lwow_t* const owobj, void* const byr, const size_t len) {
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("byr != NULL", byr != NULL);
+    LWOW_ASSERT("len > 0", len > 0);
 
-    owobj->disrepancy = OW_FIRST_DEV; /* Reset disrepancy to default value */
-    return lwowOK;
+    /* Send all bits as 1 and check if slave pulls line down */
+    return prv_exchange_bytes(owobj, NULL, byr, len);
 }
 
 /**
- * \copydoc         lwow_search_reset_raw
+ * \copydoc         lwow_read_bytes_ex_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_search_reset(lwow_t* const owobj) {
+lwow_read_bytes_ex(lwow_t* const owobj, void* const byr, const size_t len) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("byr != NULL", byr != NULL);
+    LWOW_ASSERT("len > 0", len > 0);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_search_reset_raw(owobj);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_read_bytes_ex_raw(owobj, byr, len);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Search for devices on 1-wire bus
- * \note            To reset search and to start over, use \ref lwow_search_reset function
+ * \brief           Read sinle bit from OW device
  * \param[in,out]   owobj: 1-Wire handle
- * \param[out]      rom_id: Pointer to ROM structure to save ROM
+ * \param[out]      br: Pointer to save read value, either `1` or `0`
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_search_raw(lwow_t* const owobj, lwow_rom_t* const rom_id) {
+lwow_read_bit_ex_raw(lwow_t* const owobj, uint8_t* const byr) {
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    return lwow_search_with_command_raw(owobj, LWOW_CMD_SEARCHROM, rom_id);
+    LWOW_ASSERT("byr != NULL", byr != NULL);
+
+    /* Send bit as `1` and read the response */
+    return prv_send_bit(owobj, 1, byr);
 }
 
 /**
- * \copydoc         lwow_search_raw
+ * \copydoc         lwow_read_bit_ex_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_search(lwow_t* const owobj, lwow_rom_t* const rom_id) {
+lwow_read_bit_ex(lwow_t* const owobj, uint8_t* const byr) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("byr != NULL", byr != NULL);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_search_raw(owobj, rom_id);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_read_bit_ex_raw(owobj, byr);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Search for devices on 1-wire bus with custom search command
- * \note            To reset search and to start over, use \ref lwow_search_reset function
+ * \brief           Reset search
  * \param[in,out]   owobj: 1-Wire handle
- * \param[in]       cmd: command to use for search operation
- * \param[out]      rom_id: Pointer to ROM structure to store address
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_search_with_command_raw(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id) {
-    lwowr_t res = lwowERR;
-    uint8_t id_bit_number = 0, next_disrepancy = 0, *idd = NULL;
-
+lwow_search_reset_raw(lwow_t* const owobj) {
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
-
-    idd = owobj->rom.rom;
-
-    /* Check for last device */
-    if (owobj->disrepancy == 0) {
-        lwow_search_reset_raw(owobj); /* Reset search for next search */
-        return lwowERRNODEV;          /* No devices anymore */
-    }
-
-    /* Step 1: Reset all devices on 1-Wire line to be able to listen for new command */
-    res = lwow_reset_raw(owobj);
-    if (res != lwowOK) {
-        return res;
-    }
-
-    /* Step 2: Send search rom command for all devices on 1-Wire */
-    lwow_write_byte_ex_raw(owobj, cmd, NULL); /* Start with search ROM command */
-    next_disrepancy = OW_LAST_DEV;            /* This is currently last device */
-
-    for (id_bit_number = 64U; id_bit_number > 0U;) {
-        uint8_t bit = 0, b_cpl = 0;
-
-        for (uint8_t jdx = 8; jdx > 0; --jdx, --id_bit_number) {
-            /* Read first bit and its complimentary one */
-            if (prv_send_bit(owobj, 1, &bit) != lwowOK || prv_send_bit(owobj, 1U, &b_cpl) != lwowOK) {
-                return lwowERRTXRX;
-            }
-
-            /*
-             * If we have connected many devices on 1-Wire port, b and b_cpl are ANDed between all devices.
-             *
-             * We have to react if b and b_cpl are the same:
-             *
-             *  - Both 1: No devices on 1-Wire line responded
-             *      - No device connected at all
-             *      - All devices were put to block state due to search
-             *  - Both 0: We have "collision" as device with bit 0 and bit 1 are connected
-             *
-             * If b and b_cpl are different, it means we have:
-             *
-             *  - Single device connected on 1-Wire or
-             *  - All devices on 1-Wire have the same bit value at current position
-             *      - In this case, we move to direction of b value
-             */
-            if (bit && b_cpl) {
-                goto out; /* We do not have device connected */
-            } else if (!bit && !b_cpl) {
-                /*
-                 * Decide which way to go for next scan
-                 *
-                 * Force move to "1" in case of:
-                 *
-                 *  - known diff position is larger than current bit reading
-                 *  - Previous ROM address bit 0 was 1 and known diff is different than reading
-                 *
-                 * Because we shift *id variable down by 1 bit every iteration,
-                 * *id & 0x01 always returns 1 if bit on previous ROM is the same as current bit
-                 */
-                if (id_bit_number < owobj->disrepancy || ((*idd & 0x01U) && owobj->disrepancy != id_bit_number)) {
-                    bit = 1;
-                    next_disrepancy = id_bit_number;
-                }
-            }
 
-            /*
-             * Devices are expecting master will send bit value back.
-             * All devices which do not have this bit value
-             * will go to blocked state and will wait for next reset sequence
-             *
-             * In case of "collision", we decide here which devices we will
-             * continue to scan (binary tree)
-             */
-            prv_send_bit(owobj, bit, NULL);
-
-            /*
-             * Because we shift down *id each iteration, we have to position bit value to the MSB position
-             * and it will be automatically positioned correct way.
-             */
-            *idd = (uint8_t)(*idd >> 0x01U) | (uint8_t)(bit << 0x07U);
-        }
-        ++idd; /* Go to next byte */
-    }
-out:
-    owobj->disrepancy = next_disrepancy;                              /* Save disrepancy value */
-    LWOW_MEMCPY(rom_id->rom, owobj->rom.rom, sizeof(owobj->rom.rom)); /* Copy ROM to user memory */
-    return id_bit_number == 0 ? lwowOK : lwowERRNODEV;                /* Return search result status */
+    owobj->disrepancy = OW_FIRST_DEV;       /* Reset disrepancy to default value */
+    owobj->disrepancy_family = OW_LAST_DEV; /* No other family known yet */
+    return lwowOK;
 }
 
 /**
- * \copydoc         lwow_search_with_command_raw
+ * \copydoc         lwow_search_reset_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_search_with_command(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id) {
+lwow_search_reset(lwow_t* const owobj) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_search_with_command_raw(owobj, cmd, rom_id);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_reset_raw(owobj);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Select device on 1-wire network with exact ROM number
- * \param[in]       owobj: 1-Wire handle
- * \param[in]       rom_id: 1-Wire device address to match device
+ * \brief           Set up search to start with devices of specific family code
+ *
+ * Next search finds first device with `family` code, if any.
+ * Devices are found in order, hence all devices of the same family are found one after another.
+ * Once device with different family code is returned, there are no more devices of requested family
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       family: Family code, first byte of ROM address
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_match_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+lwow_search_set_family_raw(lwow_t* const owobj, const uint8_t family) {
+    uint8_t bit;
+
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    /* Write byte to match rom exactly */
-    if (lwow_write_byte_ex_raw(owobj, LWOW_CMD_MATCHROM, NULL) != lwowOK) {
-        return lwowERR;
-    }
-    for (uint8_t idx = 0; idx < 8U; ++idx) { /* Send 8 bytes representing ROM address */
-        if (lwow_write_byte_ex_raw(owobj, rom_id->rom[idx], NULL) != lwowOK) { /* Send ROM bytes */
-            return lwowERR;
+    /*
+     * Search takes direction "1" first on collision.
+     * Follow family code bits until its highest "0" bit, then continue with "1" only
+     */
+    LWOW_MEMSET(owobj->rom.rom, 0x00, sizeof(owobj->rom.rom));
+    owobj->rom.rom[0] = family;
+    owobj->disrepancy = OW_FIRST_DEV;
+    for (bit = 8U; bit > 0; --bit) {
+        if ((family & (1U << (bit - 1U))) == 0) {
+            owobj->disrepancy = 64U - (bit - 1U); /* id bit number of family bit */
+            break;
         }
     }
+    owobj->disrepancy_family = OW_LAST_DEV;
     return lwowOK;
 }
 
 /**
- * \copydoc         lwow_match_rom_raw
+ * \copydoc         lwow_search_set_family_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_match_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+lwow_search_set_family(lwow_t* const owobj, const uint8_t family) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_match_rom_raw(owobj, rom_id);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_set_family_raw(owobj, family);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Select specific device or send skip ROM command,
- *                      depending on the `rom_id` parameter
- * \param[in]       owobj: 1-Wire handle
- * \param[in]       rom_id: 1-Wire device address to match device or `NULL` to skip the match
+ * \brief           Skip remaining devices with the same family code as last found device
+ *
+ * Next search finds first device of the next family code.
+ * If there is no other family code, search returns \ref lwowERRNODEV
+ *
+ * \param[in,out]   owobj: 1-Wire handle
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_match_or_skip_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+lwow_search_skip_family_raw(lwow_t* const owobj) {
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
 
-    /* Decide what to do */
-    return rom_id != NULL ? lwow_match_rom_raw(owobj, rom_id) : lwow_skip_rom_raw(owobj);
+    owobj->disrepancy = owobj->disrepancy_family;
+    owobj->disrepancy_family = OW_LAST_DEV;
+    return lwowOK;
 }
 
 /**
- * \copydoc         lwow_match_or_skip_rom_raw
+ * \copydoc         lwow_search_skip_family_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_match_or_skip_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+lwow_search_skip_family(lwow_t* const owobj) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_match_or_skip_rom_raw(owobj, rom_id);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_skip_family_raw(owobj);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Skip ROM address and select all devices on the network
- * \param[in]       owobj: 1-Wire handle
+ * \brief           Search for devices on 1-wire bus
+ * \note            To reset search and to start over, use \ref lwow_search_reset function
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[out]      rom_id: Pointer to ROM structure to save ROM
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_skip_rom_raw(lwow_t* const owobj) {
+lwow_search_raw(lwow_t* const owobj, lwow_rom_t* const rom_id) {
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-
-    return lwow_write_byte_ex_raw(owobj, LWOW_CMD_SKIPROM, NULL);
+    return lwow_search_with_command_raw(owobj, LWOW_CMD_SEARCHROM, rom_id);
 }
 
 /**
- * \copydoc         lwow_skip_rom_raw
+ * \copydoc         lwow_search_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_skip_rom(lwow_t* const owobj) {
+lwow_search(lwow_t* const owobj, lwow_rom_t* const rom_id) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_skip_rom_raw(owobj);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_raw(owobj, rom_id);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Calculate CRC-8 of input data
- * \param[in]       inp: Input data
- * \param[in]       len: Number of bytes
- * \return          Calculated CRC
- * \note            This function is reentrant
+ * \brief           Perform single search pass on the bus
+ *
+ * Search needs three bit-slots per ROM bit; read bit, read its complement and write direction.
+ *
+ * Bits before last disrepancy position are already known from previous search,
+ * hence all their slots are exchanged in batches, without waiting for each response.
+ * For unknown bits, direction slot is exchanged together with next bit and its complement.
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       cmd: command to use for search operation
+ * \param[in]       known: Number of leading bits, that follow path of previous search
+ * \param[out]      path_lost: Set to `1` if devices on known path did not respond.
+ *                      Search shall be repeated without known bits
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
-uint8_t
-lwow_crc(const void* inp, const size_t len) {
-    uint8_t crc = 0;
-    const uint8_t* p_data = inp;
+static lwowr_t
+prv_search_pass(lwow_t* const owobj, const uint8_t cmd, const uint8_t known, uint8_t* const path_lost) {
+    uint8_t trx[8U * LWOW_CFG_TRX_BUFF_SIZE], *idd = owobj->rom.rom, next_disrepancy = OW_LAST_DEV, pos = 0;
+    uint8_t next_disrepancy_family = OW_LAST_DEV;
+    size_t cnt = 0;
+    lwowr_t res;
 
-    if (p_data == NULL || len == 0) {
-        return 0;
+    *path_lost = 0;
+
+    /* Step 1: Reset all devices on 1-Wire line to be able to listen for new command */
+    res = lwow_reset_raw(owobj);
+    if (res != lwowOK) {
+        return res;
     }
 
-    for (size_t i = 0; i < len; ++i, ++p_data) {
-        uint8_t inbyte = *p_data;
-        for (uint8_t j = 8U; j > 0; --j) {
-            uint8_t mix = (uint8_t)(crc ^ inbyte) & 0x01U;
-            crc >>= 1U;
-            if (mix > 0) {
-                crc ^= 0x8CU;
+    /* Step 2: Send search rom command for all devices on 1-Wire, together with first bits */
+    for (uint8_t i = 0; i < 8U; ++i) {
+        trx[cnt++] = (cmd & (1U << i)) ? 0xFFU : 0x00U;
+    }
+
+    /* Step 3: Exchange bits with known direction in batches */
+    while (pos < known) {
+        size_t first, num = 0;
+
+        if (cnt + 3U > sizeof(trx)) {
+            if ((res = prv_tx_rx(owobj, trx, trx, cnt)) != lwowOK) {
+                return res;
+            }
+            cnt = 0;
+        }
+        for (first = cnt; pos + num < known && cnt + 3U <= sizeof(trx); ++num) {
+            trx[cnt++] = 0xFFU;
+            trx[cnt++] = 0xFFU;
+            trx[cnt++] = ROM_BIT_GET(idd, pos + num) ? 0xFFU : 0x00U;
+        }
+        if ((res = prv_tx_rx(owobj, trx, trx, cnt)) != lwowOK) {
+            return res;
+        }
+        for (uint8_t* p = &trx[first]; num > 0; --num, ++pos, p += 3) {
+            uint8_t bit = p[0] == 0xFFU, b_cpl = p[1] == 0xFFU, dir = ROM_BIT_GET(idd, pos);
+
+            /* No device responded, or devices only have opposite bit than previous search */
+            if ((bit && b_cpl) || (bit != b_cpl && bit != dir)) {
+                *path_lost = 1;
+                return lwowERRNODEV;
+            }
+            if (!bit && !b_cpl && dir) {
+                next_disrepancy = 64U - pos; /* Other way is still to be searched */
+                if (next_disrepancy >= OW_FAMILY_MIN) {
+                    next_disrepancy_family = next_disrepancy;
+                }
             }
-            inbyte >>= 0x01U;
         }
+        cnt = 0;
     }
-    return crc;
+
+    /* Step 4: Decide direction bit by bit */
+    for (; pos < 64U; ++pos) {
+        uint8_t bit = 0, b_cpl = 0, id_bit_number = 64U - pos;
+
+        /* Read first bit and its complimentary one, together with any pending slots */
+        if (cnt + 2U > sizeof(trx)) {
+            if ((res = prv_tx_rx(owobj, trx, trx, cnt)) != lwowOK) {
+                return res;
+            }
+            cnt = 0;
+        }
+        trx[cnt++] = 0xFFU;
+        trx[cnt++] = 0xFFU;
+        if ((res = prv_tx_rx(owobj, trx, trx, cnt)) != lwowOK) {
+            return res;
+        }
+        bit = trx[cnt - 2U] == 0xFFU;
+        b_cpl = trx[cnt - 1U] == 0xFFU;
+        cnt = 0;
+
+        /*
+         * If we have connected many devices on 1-Wire port, b and b_cpl are ANDed between all devices.
+         *
+         * We have to react if b and b_cpl are the same:
+         *
+         *  - Both 1: No devices on 1-Wire line responded
+         *      - No device connected at all
+         *      - All devices were put to block state due to search
+         *  - Both 0: We have "collision" as device with bit 0 and bit 1 are connected
+         *
+         * If b and b_cpl are different, it means we have:
+         *
+         *  - Single device connected on 1-Wire or
+         *  - All devices on 1-Wire have the same bit value at current position
+         *      - In this case, we move to direction of b value
+         */
+        if (bit && b_cpl) {
+            break; /* We do not have device connected */
+        } else if (!bit && !b_cpl) {
+            /*
+             * Decide which way to go for next scan
+             *
+             * Force move to "1" in case of:
+             *
+             *  - known diff position is larger than current bit reading
+             *  - Previous ROM address bit was 1 and known diff is different than reading
+             */
+            if (id_bit_number < owobj->disrepancy
+                || (ROM_BIT_GET(idd, pos) && owobj->disrepancy != id_bit_number)) {
+                bit = 1;
+                next_disrepancy = id_bit_number;
+                if (next_disrepancy >= OW_FAMILY_MIN) {
+                    next_disrepancy_family = next_disrepancy;
+                }
+            }
+        }
+
+        /* Save bit value to ROM address */
+        if (bit) {
+            idd[pos >> 0x03U] |= (uint8_t)(1U << (pos & 0x07U));
+        } else {
+            idd[pos >> 0x03U] &= (uint8_t)~(1U << (pos & 0x07U));
+        }
+
+        /*
+         * Devices are expecting master will send bit value back.
+         * All devices which do not have this bit value
+         * will go to blocked state and will wait for next reset sequence
+         *
+         * In case of "collision", we decide here which devices we will
+         * continue to scan (binary tree)
+         *
+         * Value is sent together with next bit reading
+         */
+        trx[cnt++] = bit ? 0xFFU : 0x00U;
+    }
+
+    /* Send last direction bit */
+    if (cnt > 0 && (res = prv_tx_rx(owobj, trx, trx, cnt)) != lwowOK) {
+        return res;
+    }
+    owobj->disrepancy = next_disrepancy;               /* Save disrepancy value */
+    owobj->disrepancy_family = next_disrepancy_family; /* Save disrepancy within family code */
+    return pos == 64U ? lwowOK : lwowERRNODEV; /* Return search result status */
 }
 
 /**
- * \brief           Search devices on 1-wire network by using callback function and custom search command
+ * \brief           Perform single search pass on the bus with low-level search triplet function
  *
- * When new device is detected, callback function `func` is called to notify user
+ * Each ROM bit is exchanged with single call to `search_triplet` driver function.
+ * When driver fails first triplet, it does not support current speed
+ * and search state is left unchanged, for the caller to repeat pass with UART slots after new reset
  *
- * \param[in]       owobj: 1-Wire handle
- * \param[in]       cmd: 1-Wire search command
- * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
- * \param[in]       func: Callback function to call for each device
- * \param[in]       arg: Custom user argument, used in callback function
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       cmd: command to use for search operation
+ * \param[out]      fallback: Output variable set to `1` when pass has to be repeated with UART slots,
+ *                      `0` otherwise
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_search_pass_triplet(lwow_t* const owobj, const uint8_t cmd, uint8_t* const fallback) {
+    uint8_t *idd = owobj->rom.rom, next_disrepancy = OW_LAST_DEV, next_disrepancy_family = OW_LAST_DEV, pos = 0;
+
+    *fallback = 0;
+
+    /* Send search command, reset has been generated by the caller */
+    if (prv_exchange_bytes(owobj, &cmd, NULL, 1U) != lwowOK) {
+        return lwowERRTXRX;
+    }
+
+    for (; pos < 64U; ++pos) {
+        uint8_t bit = 0, b_cpl = 0, dir = 0, id_bit_number = 64U - pos;
+
+        /* Direction in case of collision follows the same rules as for bit-by-bit search */
+        dir = id_bit_number < owobj->disrepancy || (ROM_BIT_GET(idd, pos) && owobj->disrepancy != id_bit_number);
+        if (!owobj->ll_drv->search_triplet(owobj->speed, dir, &bit, &b_cpl, &dir, owobj->arg)) {
+            *fallback = pos == 0;
+            return lwowERRTXRX;
+        }
+        if (bit && b_cpl) {
+            break; /* We do not have device connected */
+        } else if (!bit && !b_cpl && dir) {
+            next_disrepancy = id_bit_number;
+            if (next_disrepancy >= OW_FAMILY_MIN) {
+                next_disrepancy_family = next_disrepancy;
+            }
+        }
+
+        /* Save bit value to ROM address */
+        if (dir) {
+            idd[pos >> 0x03U] |= (uint8_t)(1U << (pos & 0x07U));
+        } else {
+            idd[pos >> 0x03U] &= (uint8_t)~(1U << (pos & 0x07U));
+        }
+    }
+    owobj->disrepancy = next_disrepancy;               /* Save disrepancy value */
+    owobj->disrepancy_family = next_disrepancy_family; /* Save disrepancy within family code */
+    return pos == 64U ? lwowOK : lwowERRNODEV;         /* Return search result status */
+}
+
+/**
+ * \brief           Search for devices on 1-wire bus with custom search command
+ * \note            To reset search and to start over, use \ref lwow_search_reset function
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       cmd: command to use for search operation
+ * \param[out]      rom_id: Pointer to ROM structure to store address
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
- * \note            This function is thread-safe
  */
 lwowr_t
-lwow_search_with_command_callback(lwow_t* const owobj, const uint8_t cmd, size_t* const roms_found,
-                                  const lwow_search_cb_fn func, void* arg) {
+lwow_search_with_command_raw(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id) {
     lwowr_t res = lwowERR;
-    lwow_rom_t rom_id = {0};
-    size_t idx = 0;
+    uint8_t path_lost = 0, fallback = 0, first;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("func != NULL", func != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    lwow_protect(owobj, 1U);
-    /* Search device-by-device until all found */
-    for (idx = 0, res = lwow_search_reset_raw(owobj);
-         res == lwowOK && (res = lwow_search_with_command_raw(owobj, cmd, &rom_id)) == lwowOK; ++idx) {
-        res = func(owobj, &rom_id, idx, arg);
-        if (res != lwowOK) {
-            break;
+    first = owobj->disrepancy == OW_FIRST_DEV;
+
+    /* Check for last device */
+    if (owobj->disrepancy == 0) {
+        lwow_search_reset_raw(owobj); /* Reset search for next search */
+        return lwowERRNODEV;          /* No devices anymore */
+    }
+
+    if (owobj->ll_drv->search_triplet != NULL) {
+        if ((res = lwow_reset_raw(owobj)) == lwowOK) {
+            res = prv_search_pass_triplet(owobj, cmd, &fallback);
         }
     }
-    func(owobj, NULL, idx, arg); /* Call with NULL rom_id parameter */
-    lwow_unprotect(owobj, 1U);
-    SET_NOT_NULL(roms_found, idx); /* Set number of roms found */
-    if (res == lwowERRNODEV) {     /* `No device` might not be an error, but simply no devices on bus */
-        res = lwowOK;
+    if (owobj->ll_drv->search_triplet == NULL || fallback) {
+        /*
+         * All bits before last disrepancy follow the path of previous device.
+         * If any of devices on this path has been removed, repeat search bit by bit
+         */
+        res = prv_search_pass(owobj, cmd, owobj->disrepancy != OW_FIRST_DEV ? 64U - owobj->disrepancy : 0,
+                              &path_lost);
+        if (path_lost) {
+            res = prv_search_pass(owobj, cmd, 0, &path_lost);
+        }
+    }
+    if (res == lwowOK || res == lwowERRNODEV) {
+        LWOW_MEMCPY(rom_id->rom, owobj->rom.rom, sizeof(owobj->rom.rom)); /* Copy ROM to user memory */
+    }
+    prv_resume_update(owobj, res == lwowOK ? owobj->rom.rom : NULL); /* Found device remains selected */
+
+    /* First search without any collision means there is single device on the bus */
+    if (res == lwowOK && cmd == LWOW_CMD_SEARCHROM && first) {
+        owobj->single_drop = owobj->disrepancy == OW_LAST_DEV;
     }
     return res;
 }
 
 /**
- * \brief           Search devices on 1-wire network by using callback function and `SEARCH_ROM` 1-Wire command
- *
- * When new device is detected, callback function `func` is called to notify user
- *
- * \param[in]       owobj: 1-Wire handle
- * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
- * \param[in]       func: Callback function to call for each device
- * \param[in]       arg: Custom user argument, used in callback function
- * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ * \copydoc         lwow_search_with_command_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_search_with_callback(lwow_t* const owobj, size_t* const roms_found, const lwow_search_cb_fn func, void* arg) {
-    return lwow_search_with_command_callback(owobj, LWOW_CMD_SEARCHROM, roms_found, func, arg);
+lwow_search_with_command(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_with_command_raw(owobj, cmd, rom_id);
+    lwow_unprotect(owobj, 1U);
+    return res;
 }
 
 /**
- * \brief           Search for devices on 1-Wire network with command and store ROM IDs to input array
+ * \brief           Select device on 1-wire network with exact ROM number
  * \param[in]       owobj: 1-Wire handle
- * \param[in]       cmd: 1-Wire search command
- * \param[in]       rom_id_arr: Pointer to output array to store found ROM IDs into
- * \param[in]       rom_len: Length of input ROM array
- * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
+ * \param[in]       rom_id: 1-Wire device address to match device
  * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_search_devices_with_command_raw(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id_arr,
-                                     const size_t rom_len, size_t* const roms_found) {
-    lwowr_t res = lwowERR;
-    size_t cnt = 0;
+lwow_match_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    uint8_t buff[1U + sizeof(rom_id->rom)];
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
-    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    for (cnt = 0, res = lwow_search_reset_raw(owobj); cnt < rom_len; ++cnt) {
-        res = lwow_search_with_command_raw(owobj, cmd, &rom_id_arr[cnt]);
-        if (res != lwowOK) {
-            break;
+#if LWOW_CFG_RESUME_ROM
+    /* Same device is still selected, resume command is enough */
+    if (owobj->resume_valid && LWOW_MEMCMP(owobj->resume_rom.rom, rom_id->rom, sizeof(rom_id->rom)) == 0) {
+        if (lwow_write_byte_ex_raw(owobj, LWOW_CMD_RESUME, NULL) != lwowOK) {
+            prv_resume_update(owobj, NULL);
+            return lwowERR;
         }
+        return lwowOK;
     }
-    SET_NOT_NULL(roms_found, cnt); /* Set number of roms found */
-    if (res == lwowERRNODEV && cnt > 0) {
-        res = lwowOK;
+#endif /* LWOW_CFG_RESUME_ROM */
+
+    /* Match rom command followed by 8 bytes representing ROM address, sent at once */
+    buff[0] = LWOW_CMD_MATCHROM;
+    LWOW_MEMCPY(&buff[1], rom_id->rom, sizeof(rom_id->rom));
+    if (prv_exchange_bytes(owobj, buff, NULL, sizeof(buff)) != lwowOK) {
+        prv_resume_update(owobj, NULL);
+        return lwowERR;
     }
-    return res;
+    prv_resume_update(owobj, rom_id->rom);
+    return lwowOK;
 }
 
 /**
- * \copydoc         lwow_search_devices_with_command_raw
+ * \copydoc         lwow_match_rom_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_search_devices_with_command(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id_arr,
-                                 const size_t rom_len, size_t* const roms_found) {
+lwow_match_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
-    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_search_devices_with_command_raw(owobj, cmd, rom_id_arr, rom_len, roms_found);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_match_rom_raw(owobj, rom_id);
     lwow_unprotect(owobj, 1U);
     return res;
 }
 
 /**
- * \brief           Search for devices on 1-Wire network with default command and store ROM IDs to input array
+ * \brief           Read ROM address of the only device on the bus
+ *
+ * Read ROM command may be used only when single device is connected to the bus,
+ * otherwise data from all devices collide and CRC check fails
+ *
+ * \note            Reset must be generated before calling this function, as for any other ROM command
  * \param[in]       owobj: 1-Wire handle
- * \param[in]       rom_id_arr: Pointer to output array to store found ROM IDs into
- * \param[in]       rom_len: Length of input ROM array
- * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
- * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ * \param[out]      rom_id: Pointer to ROM structure to store address
+ * \return          \ref lwowOK on success, \ref lwowERRCRC if CRC check fails,
+ *                      member of \ref lwowr_t otherwise
  */
 lwowr_t
-lwow_search_devices_raw(lwow_t* const owobj, lwow_rom_t* const rom_id_arr, const size_t rom_len,
-                        size_t* const roms_found) {
+lwow_read_rom_raw(lwow_t* const owobj, lwow_rom_t* const rom_id) {
+    uint8_t buff[1U + sizeof(rom_id->rom)];
+    lwowr_t res;
+
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
-    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    return lwow_search_devices_with_command_raw(owobj, LWOW_CMD_SEARCHROM, rom_id_arr, rom_len, roms_found);
+    /* Read ROM command followed by 8 read bytes, exchanged at once */
+    LWOW_MEMSET(buff, 0xFF, sizeof(buff));
+    buff[0] = LWOW_CMD_READROM;
+    if ((res = prv_exchange_bytes(owobj, buff, buff, sizeof(buff))) != lwowOK) {
+        prv_resume_update(owobj, NULL);
+        return res;
+    }
+    /* Zero family code is not valid, all-zero data are result of many devices responding at the same time */
+    if (lwow_crc(&buff[1], sizeof(rom_id->rom)) != 0 || buff[1] == 0) {
+        prv_resume_update(owobj, NULL);
+        return lwowERRCRC;
+    }
+    LWOW_MEMCPY(rom_id->rom, &buff[1], sizeof(rom_id->rom));
+    prv_resume_update(owobj, rom_id->rom); /* Device remains selected */
+    return lwowOK;
 }
 
 /**
- * \copydoc         lwow_search_devices_raw
+ * \copydoc         lwow_read_rom_raw
  * \note            This function is thread-safe
  */
 lwowr_t
-lwow_search_devices(lwow_t* const owobj, lwow_rom_t* const rom_id_arr, const size_t rom_len, size_t* const roms_found) {
+lwow_read_rom(lwow_t* const owobj, lwow_rom_t* const rom_id) {
     lwowr_t res = lwowERR;
 
     LWOW_ASSERT("owobj != NULL", owobj != NULL);
-    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
-    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
 
-    lwow_protect(owobj, 1U);
-    res = lwow_search_devices_raw(owobj, rom_id_arr, rom_len, roms_found);
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_read_rom_raw(owobj, rom_id);
     lwow_unprotect(owobj, 1U);
     return res;
 }
+
+/**
+ * \brief           Enable or disable single-drop mode
+ *
+ * In single-drop mode, \ref lwow_match_or_skip_rom_raw always sends skip ROM command,
+ * saving `64` time slots on every device selection.
+ * Mode is enabled automatically when search from the beginning finds single device only,
+ * and disabled when it finds more devices
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       single_drop: Set to `1` to enable or `0` to disable single-drop mode
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_set_single_drop(lwow_t* const owobj, const uint8_t single_drop) {
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    owobj->single_drop = single_drop > 0;
+    lwow_unprotect(owobj, 1U);
+    return lwowOK;
+}
+
+/**
+ * \brief           Check if instance is in single-drop mode
+ * \param[in]       owobj: 1-Wire handle
+ * \return          `1` if single-drop mode is active, `0` otherwise
+ */
+uint8_t
+lwow_is_single_drop(lwow_t* const owobj) {
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    return owobj->single_drop;
+}
+
+/**
+ * \brief           Reset the bus at standard speed and switch all devices to overdrive speed
+ *
+ * All devices supporting overdrive are selected and communication continues at overdrive speed.
+ * Devices stay at overdrive speed until reset at standard speed is generated
+ *
+ * \note            Function generates reset pulse on its own, before sending the command
+ * \param[in]       owobj: 1-Wire handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_od_skip_rom_raw(lwow_t* const owobj) {
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    owobj->speed = LWOW_SPEED_STANDARD;
+    prv_resume_update(owobj, NULL);
+    if ((res = prv_reset(owobj, LWOW_SPEED_STANDARD)) != lwowOK
+        || (res = lwow_write_byte_ex_raw(owobj, LWOW_CMD_OD_SKIPROM, NULL)) != lwowOK) {
+        return res;
+    }
+    owobj->speed = LWOW_SPEED_OVERDRIVE;
+    return lwowOK;
+}
+
+/**
+ * \copydoc         lwow_od_skip_rom_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_od_skip_rom(lwow_t* const owobj) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_od_skip_rom_raw(owobj);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Reset the bus at standard speed and switch single device to overdrive speed
+ *
+ * Command is sent at standard speed, ROM address is sent at overdrive speed.
+ * Selected device stays at overdrive speed until reset at standard speed is generated
+ *
+ * \note            Function generates reset pulse on its own, before sending the command
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to match
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_od_match_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    owobj->speed = LWOW_SPEED_STANDARD;
+    prv_resume_update(owobj, NULL);
+    if ((res = prv_reset(owobj, LWOW_SPEED_STANDARD)) != lwowOK
+        || (res = lwow_write_byte_ex_raw(owobj, LWOW_CMD_OD_MATCHROM, NULL)) != lwowOK) {
+        return res;
+    }
+    owobj->speed = LWOW_SPEED_OVERDRIVE;
+    if ((res = prv_exchange_bytes(owobj, rom_id->rom, NULL, sizeof(rom_id->rom))) == lwowOK) {
+        prv_resume_update(owobj, rom_id->rom);
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_od_match_rom_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_od_match_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_od_match_rom_raw(owobj, rom_id);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Get currently active bus speed
+ * \param[in]       owobj: 1-Wire handle
+ * \return          Member of \ref lwow_speed_t
+ */
+uint8_t
+lwow_get_speed(lwow_t* const owobj) {
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    return owobj->speed;
+}
+
+/**
+ * \brief           Select specific device or send skip ROM command,
+ *                      depending on the `rom_id` parameter
+ *
+ * Skip ROM command is sent also when instance is in single-drop mode.
+ * \sa              lwow_set_single_drop
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to match device or `NULL` to skip the match
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_match_or_skip_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    /* Decide what to do, single device on the bus does not need to be matched */
+    return rom_id != NULL && !owobj->single_drop ? lwow_match_rom_raw(owobj, rom_id) : lwow_skip_rom_raw(owobj);
+}
+
+/**
+ * \copydoc         lwow_match_or_skip_rom_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_match_or_skip_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_match_or_skip_rom_raw(owobj, rom_id);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Skip ROM address and select all devices on the network
+ * \param[in]       owobj: 1-Wire handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_skip_rom_raw(lwow_t* const owobj) {
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    prv_resume_update(owobj, NULL); /* Skip ROM clears resume selection of all devices */
+    return lwow_write_byte_ex_raw(owobj, LWOW_CMD_SKIPROM, NULL);
+}
+
+/**
+ * \copydoc         lwow_skip_rom_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_skip_rom(lwow_t* const owobj) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_skip_rom_raw(owobj);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+#if LWOW_CFG_CRC_TABLE
+/**
+ * \brief           CRC-8 lookup tables, polynomial `0x8C` (reflected `x^8 + x^5 + x^4 + 1`)
+ *
+ * Table `0` holds CRC of single byte, table `n` holds CRC of single byte followed by `n` zero bytes
+ */
+static const uint8_t crc8_table[LWOW_CFG_CRC_TABLE][256] = {
+    {
+        0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41,
+        0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC,
+        0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62,
+        0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF,
+        0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07,
+        0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A,
+        0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24,
+        0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9,
+        0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD,
+        0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50,
+        0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE,
+        0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73,
+        0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B,
+        0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16,
+        0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8,
+        0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35,
+    },
+#if LWOW_CFG_CRC_TABLE >= 4
+    {
+        0x00, 0xC4, 0x91, 0x55, 0x3B, 0xFF, 0xAA, 0x6E, 0x76, 0xB2, 0xE7, 0x23, 0x4D, 0x89, 0xDC, 0x18,
+        0xEC, 0x28, 0x7D, 0xB9, 0xD7, 0x13, 0x46, 0x82, 0x9A, 0x5E, 0x0B, 0xCF, 0xA1, 0x65, 0x30, 0xF4,
+        0xC1, 0x05, 0x50, 0x94, 0xFA, 0x3E, 0x6B, 0xAF, 0xB7, 0x73, 0x26, 0xE2, 0x8C, 0x48, 0x1D, 0xD9,
+        0x2D, 0xE9, 0xBC, 0x78, 0x16, 0xD2, 0x87, 0x43, 0x5B, 0x9F, 0xCA, 0x0E, 0x60, 0xA4, 0xF1, 0x35,
+        0x9B, 0x5F, 0x0A, 0xCE, 0xA0, 0x64, 0x31, 0xF5, 0xED, 0x29, 0x7C, 0xB8, 0xD6, 0x12, 0x47, 0x83,
+        0x77, 0xB3, 0xE6, 0x22, 0x4C, 0x88, 0xDD, 0x19, 0x01, 0xC5, 0x90, 0x54, 0x3A, 0xFE, 0xAB, 0x6F,
+        0x5A, 0x9E, 0xCB, 0x0F, 0x61, 0xA5, 0xF0, 0x34, 0x2C, 0xE8, 0xBD, 0x79, 0x17, 0xD3, 0x86, 0x42,
+        0xB6, 0x72, 0x27, 0xE3, 0x8D, 0x49, 0x1C, 0xD8, 0xC0, 0x04, 0x51, 0x95, 0xFB, 0x3F, 0x6A, 0xAE,
+        0x2F, 0xEB, 0xBE, 0x7A, 0x14, 0xD0, 0x85, 0x41, 0x59, 0x9D, 0xC8, 0x0C, 0x62, 0xA6, 0xF3, 0x37,
+        0xC3, 0x07, 0x52, 0x96, 0xF8, 0x3C, 0x69, 0xAD, 0xB5, 0x71, 0x24, 0xE0, 0x8E, 0x4A, 0x1F, 0xDB,
+        0xEE, 0x2A, 0x7F, 0xBB, 0xD5, 0x11, 0x44, 0x80, 0x98, 0x5C, 0x09, 0xCD, 0xA3, 0x67, 0x32, 0xF6,
+        0x02, 0xC6, 0x93, 0x57, 0x39, 0xFD, 0xA8, 0x6C, 0x74, 0xB0, 0xE5, 0x21, 0x4F, 0x8B, 0xDE, 0x1A,
+        0xB4, 0x70, 0x25, 0xE1, 0x8F, 0x4B, 0x1E, 0xDA, 0xC2, 0x06, 0x53, 0x97, 0xF9, 0x3D, 0x68, 0xAC,
+        0x58, 0x9C, 0xC9, 0x0D, 0x63, 0xA7, 0xF2, 0x36, 0x2E, 0xEA, 0xBF, 0x7B, 0x15, 0xD1, 0x84, 0x40,
+        0x75, 0xB1, 0xE4, 0x20, 0x4E, 0x8A, 0xDF, 0x1B, 0x03, 0xC7, 0x92, 0x56, 0x38, 0xFC, 0xA9, 0x6D,
+        0x99, 0x5D, 0x08, 0xCC, 0xA2, 0x66, 0x33, 0xF7, 0xEF, 0x2B, 0x7E, 0xBA, 0xD4, 0x10, 0x45, 0x81,
+    },
+    {
+        0x00, 0xAB, 0x4F, 0xE4, 0x9E, 0x35, 0xD1, 0x7A, 0x25, 0x8E, 0x6A, 0xC1, 0xBB, 0x10, 0xF4, 0x5F,
+        0x4A, 0xE1, 0x05, 0xAE, 0xD4, 0x7F, 0x9B, 0x30, 0x6F, 0xC4, 0x20, 0x8B, 0xF1, 0x5A, 0xBE, 0x15,
+        0x94, 0x3F, 0xDB, 0x70, 0x0A, 0xA1, 0x45, 0xEE, 0xB1, 0x1A, 0xFE, 0x55, 0x2F, 0x84, 0x60, 0xCB,
+        0xDE, 0x75, 0x91, 0x3A, 0x40, 0xEB, 0x0F, 0xA4, 0xFB, 0x50, 0xB4, 0x1F, 0x65, 0xCE, 0x2A, 0x81,
+        0x31, 0x9A, 0x7E, 0xD5, 0xAF, 0x04, 0xE0, 0x4B, 0x14, 0xBF, 0x5B, 0xF0, 0x8A, 0x21, 0xC5, 0x6E,
+        0x7B, 0xD0, 0x34, 0x9F, 0xE5, 0x4E, 0xAA, 0x01, 0x5E, 0xF5, 0x11, 0xBA, 0xC0, 0x6B, 0x8F, 0x24,
+        0xA5, 0x0E, 0xEA, 0x41, 0x3B, 0x90, 0x74, 0xDF, 0x80, 0x2B, 0xCF, 0x64, 0x1E, 0xB5, 0x51, 0xFA,
+        0xEF, 0x44, 0xA0, 0x0B, 0x71, 0xDA, 0x3E, 0x95, 0xCA, 0x61, 0x85, 0x2E, 0x54, 0xFF, 0x1B, 0xB0,
+        0x62, 0xC9, 0x2D, 0x86, 0xFC, 0x57, 0xB3, 0x18, 0x47, 0xEC, 0x08, 0xA3, 0xD9, 0x72, 0x96, 0x3D,
+        0x28, 0x83, 0x67, 0xCC, 0xB6, 0x1D, 0xF9, 0x52, 0x0D, 0xA6, 0x42, 0xE9, 0x93, 0x38, 0xDC, 0x77,
+        0xF6, 0x5D, 0xB9, 0x12, 0x68, 0xC3, 0x27, 0x8C, 0xD3, 0x78, 0x9C, 0x37, 0x4D, 0xE6, 0x02, 0xA9,
+        0xBC, 0x17, 0xF3, 0x58, 0x22, 0x89, 0x6D, 0xC6, 0x99, 0x32, 0xD6, 0x7D, 0x07, 0xAC, 0x48, 0xE3,
+        0x53, 0xF8, 0x1C, 0xB7, 0xCD, 0x66, 0x82, 0x29, 0x76, 0xDD, 0x39, 0x92, 0xE8, 0x43, 0xA7, 0x0C,
+        0x19, 0xB2, 0x56, 0xFD, 0x87, 0x2C, 0xC8, 0x63, 0x3C, 0x97, 0x73, 0xD8, 0xA2, 0x09, 0xED, 0x46,
+        0xC7, 0x6C, 0x88, 0x23, 0x59, 0xF2, 0x16, 0xBD, 0xE2, 0x49, 0xAD, 0x06, 0x7C, 0xD7, 0x33, 0x98,
+        0x8D, 0x26, 0xC2, 0x69, 0x13, 0xB8, 0x5C, 0xF7, 0xA8, 0x03, 0xE7, 0x4C, 0x36, 0x9D, 0x79, 0xD2,
+    },
+    {
+        0x00, 0x8F, 0x07, 0x88, 0x0E, 0x81, 0x09, 0x86, 0x1C, 0x93, 0x1B, 0x94, 0x12, 0x9D, 0x15, 0x9A,
+        0x38, 0xB7, 0x3F, 0xB0, 0x36, 0xB9, 0x31, 0xBE, 0x24, 0xAB, 0x23, 0xAC, 0x2A, 0xA5, 0x2D, 0xA2,
+        0x70, 0xFF, 0x77, 0xF8, 0x7E, 0xF1, 0x79, 0xF6, 0x6C, 0xE3, 0x6B, 0xE4, 0x62, 0xED, 0x65, 0xEA,
+        0x48, 0xC7, 0x4F, 0xC0, 0x46, 0xC9, 0x41, 0xCE, 0x54, 0xDB, 0x53, 0xDC, 0x5A, 0xD5, 0x5D, 0xD2,
+        0xE0, 0x6F, 0xE7, 0x68, 0xEE, 0x61, 0xE9, 0x66, 0xFC, 0x73, 0xFB, 0x74, 0xF2, 0x7D, 0xF5, 0x7A,
+        0xD8, 0x57, 0xDF, 0x50, 0xD6, 0x59, 0xD1, 0x5E, 0xC4, 0x4B, 0xC3, 0x4C, 0xCA, 0x45, 0xCD, 0x42,
+        0x90, 0x1F, 0x97, 0x18, 0x9E, 0x11, 0x99, 0x16, 0x8C, 0x03, 0x8B, 0x04, 0x82, 0x0D, 0x85, 0x0A,
+        0xA8, 0x27, 0xAF, 0x20, 0xA6, 0x29, 0xA1, 0x2E, 0xB4, 0x3B, 0xB3, 0x3C, 0xBA, 0x35, 0xBD, 0x32,
+        0xD9, 0x56, 0xDE, 0x51, 0xD7, 0x58, 0xD0, 0x5F, 0xC5, 0x4A, 0xC2, 0x4D, 0xCB, 0x44, 0xCC, 0x43,
+        0xE1, 0x6E, 0xE6, 0x69, 0xEF, 0x60, 0xE8, 0x67, 0xFD, 0x72, 0xFA, 0x75, 0xF3, 0x7C, 0xF4, 0x7B,
+        0xA9, 0x26, 0xAE, 0x21, 0xA7, 0x28, 0xA0, 0x2F, 0xB5, 0x3A, 0xB2, 0x3D, 0xBB, 0x34, 0xBC, 0x33,
+        0x91, 0x1E, 0x96, 0x19, 0x9F, 0x10, 0x98, 0x17, 0x8D, 0x02, 0x8A, 0x05, 0x83, 0x0C, 0x84, 0x0B,
+        0x39, 0xB6, 0x3E, 0xB1, 0x37, 0xB8, 0x30, 0xBF, 0x25, 0xAA, 0x22, 0xAD, 0x2B, 0xA4, 0x2C, 0xA3,
+        0x01, 0x8E, 0x06, 0x89, 0x0F, 0x80, 0x08, 0x87, 0x1D, 0x92, 0x1A, 0x95, 0x13, 0x9C, 0x14, 0x9B,
+        0x49, 0xC6, 0x4E, 0xC1, 0x47, 0xC8, 0x40, 0xCF, 0x55, 0xDA, 0x52, 0xDD, 0x5B, 0xD4, 0x5C, 0xD3,
+        0x71, 0xFE, 0x76, 0xF9, 0x7F, 0xF0, 0x78, 0xF7, 0x6D, 0xE2, 0x6A, 0xE5, 0x63, 0xEC, 0x64, 0xEB,
+    },
+#endif /* LWOW_CFG_CRC_TABLE >= 4 */
+#if LWOW_CFG_CRC_TABLE >= 8
+    {
+        0x00, 0xCD, 0x83, 0x4E, 0x1F, 0xD2, 0x9C, 0x51, 0x3E, 0xF3, 0xBD, 0x70, 0x21, 0xEC, 0xA2, 0x6F,
+        0x7C, 0xB1, 0xFF, 0x32, 0x63, 0xAE, 0xE0, 0x2D, 0x42, 0x8F, 0xC1, 0x0C, 0x5D, 0x90, 0xDE, 0x13,
+        0xF8, 0x35, 0x7B, 0xB6, 0xE7, 0x2A, 0x64, 0xA9, 0xC6, 0x0B, 0x45, 0x88, 0xD9, 0x14, 0x5A, 0x97,
+        0x84, 0x49, 0x07, 0xCA, 0x9B, 0x56, 0x18, 0xD5, 0xBA, 0x77, 0x39, 0xF4, 0xA5, 0x68, 0x26, 0xEB,
+        0xE9, 0x24, 0x6A, 0xA7, 0xF6, 0x3B, 0x75, 0xB8, 0xD7, 0x1A, 0x54, 0x99, 0xC8, 0x05, 0x4B, 0x86,
+        0x95, 0x58, 0x16, 0xDB, 0x8A, 0x47, 0x09, 0xC4, 0xAB, 0x66, 0x28, 0xE5, 0xB4, 0x79, 0x37, 0xFA,
+        0x11, 0xDC, 0x92, 0x5F, 0x0E, 0xC3, 0x8D, 0x40, 0x2F, 0xE2, 0xAC, 0x61, 0x30, 0xFD, 0xB3, 0x7E,
+        0x6D, 0xA0, 0xEE, 0x23, 0x72, 0xBF, 0xF1, 0x3C, 0x53, 0x9E, 0xD0, 0x1D, 0x4C, 0x81, 0xCF, 0x02,
+        0xCB, 0x06, 0x48, 0x85, 0xD4, 0x19, 0x57, 0x9A, 0xF5, 0x38, 0x76, 0xBB, 0xEA, 0x27, 0x69, 0xA4,
+        0xB7, 0x7A, 0x34, 0xF9, 0xA8, 0x65, 0x2B, 0xE6, 0x89, 0x44, 0x0A, 0xC7, 0x96, 0x5B, 0x15, 0xD8,
+        0x33, 0xFE, 0xB0, 0x7D, 0x2C, 0xE1, 0xAF, 0x62, 0x0D, 0xC0, 0x8E, 0x43, 0x12, 0xDF, 0x91, 0x5C,
+        0x4F, 0x82, 0xCC, 0x01, 0x50, 0x9D, 0xD3, 0x1E, 0x71, 0xBC, 0xF2, 0x3F, 0x6E, 0xA3, 0xED, 0x20,
+        0x22, 0xEF, 0xA1, 0x6C, 0x3D, 0xF0, 0xBE, 0x73, 0x1C, 0xD1, 0x9F, 0x52, 0x03, 0xCE, 0x80, 0x4D,
+        0x5E, 0x93, 0xDD, 0x10, 0x41, 0x8C, 0xC2, 0x0F, 0x60, 0xAD, 0xE3, 0x2E, 0x7F, 0xB2, 0xFC, 0x31,
+        0xDA, 0x17, 0x59, 0x94, 0xC5, 0x08, 0x46, 0x8B, 0xE4, 0x29, 0x67, 0xAA, 0xFB, 0x36, 0x78, 0xB5,
+        0xA6, 0x6B, 0x25, 0xE8, 0xB9, 0x74, 0x3A, 0xF7, 0x98, 0x55, 0x1B, 0xD6, 0x87, 0x4A, 0x04, 0xC9,
+    },
+    {
+        0x00, 0x37, 0x6E, 0x59, 0xDC, 0xEB, 0xB2, 0x85, 0xA1, 0x96, 0xCF, 0xF8, 0x7D, 0x4A, 0x13, 0x24,
+        0x5B, 0x6C, 0x35, 0x02, 0x87, 0xB0, 0xE9, 0xDE, 0xFA, 0xCD, 0x94, 0xA3, 0x26, 0x11, 0x48, 0x7F,
+        0xB6, 0x81, 0xD8, 0xEF, 0x6A, 0x5D, 0x04, 0x33, 0x17, 0x20, 0x79, 0x4E, 0xCB, 0xFC, 0xA5, 0x92,
+        0xED, 0xDA, 0x83, 0xB4, 0x31, 0x06, 0x5F, 0x68, 0x4C, 0x7B, 0x22, 0x15, 0x90, 0xA7, 0xFE, 0xC9,
+        0x75, 0x42, 0x1B, 0x2C, 0xA9, 0x9E, 0xC7, 0xF0, 0xD4, 0xE3, 0xBA, 0x8D, 0x08, 0x3F, 0x66, 0x51,
+        0x2E, 0x19, 0x40, 0x77, 0xF2, 0xC5, 0x9C, 0xAB, 0x8F, 0xB8, 0xE1, 0xD6, 0x53, 0x64, 0x3D, 0x0A,
+        0xC3, 0xF4, 0xAD, 0x9A, 0x1F, 0x28, 0x71, 0x46, 0x62, 0x55, 0x0C, 0x3B, 0xBE, 0x89, 0xD0, 0xE7,
+        0x98, 0xAF, 0xF6, 0xC1, 0x44, 0x73, 0x2A, 0x1D, 0x39, 0x0E, 0x57, 0x60, 0xE5, 0xD2, 0x8B, 0xBC,
+        0xEA, 0xDD, 0x84, 0xB3, 0x36, 0x01, 0x58, 0x6F, 0x4B, 0x7C, 0x25, 0x12, 0x97, 0xA0, 0xF9, 0xCE,
+        0xB1, 0x86, 0xDF, 0xE8, 0x6D, 0x5A, 0x03, 0x34, 0x10, 0x27, 0x7E, 0x49, 0xCC, 0xFB, 0xA2, 0x95,
+        0x5C, 0x6B, 0x32, 0x05, 0x80, 0xB7, 0xEE, 0xD9, 0xFD, 0xCA, 0x93, 0xA4, 0x21, 0x16, 0x4F, 0x78,
+        0x07, 0x30, 0x69, 0x5E, 0xDB, 0xEC, 0xB5, 0x82, 0xA6, 0x91, 0xC8, 0xFF, 0x7A, 0x4D, 0x14, 0x23,
+        0x9F, 0xA8, 0xF1, 0xC6, 0x43, 0x74, 0x2D, 0x1A, 0x3E, 0x09, 0x50, 0x67, 0xE2, 0xD5, 0x8C, 0xBB,
+        0xC4, 0xF3, 0xAA, 0x9D, 0x18, 0x2F, 0x76, 0x41, 0x65, 0x52, 0x0B, 0x3C, 0xB9, 0x8E, 0xD7, 0xE0,
+        0x29, 0x1E, 0x47, 0x70, 0xF5, 0xC2, 0x9B, 0xAC, 0x88, 0xBF, 0xE6, 0xD1, 0x54, 0x63, 0x3A, 0x0D,
+        0x72, 0x45, 0x1C, 0x2B, 0xAE, 0x99, 0xC0, 0xF7, 0xD3, 0xE4, 0xBD, 0x8A, 0x0F, 0x38, 0x61, 0x56,
+    },
+    {
+        0x00, 0x3D, 0x7A, 0x47, 0xF4, 0xC9, 0x8E, 0xB3, 0xF1, 0xCC, 0x8B, 0xB6, 0x05, 0x38, 0x7F, 0x42,
+        0xFB, 0xC6, 0x81, 0xBC, 0x0F, 0x32, 0x75, 0x48, 0x0A, 0x37, 0x70, 0x4D, 0xFE, 0xC3, 0x84, 0xB9,
+        0xEF, 0xD2, 0x95, 0xA8, 0x1B, 0x26, 0x61, 0x5C, 0x1E, 0x23, 0x64, 0x59, 0xEA, 0xD7, 0x90, 0xAD,
+        0x14, 0x29, 0x6E, 0x53, 0xE0, 0xDD, 0x9A, 0xA7, 0xE5, 0xD8, 0x9F, 0xA2, 0x11, 0x2C, 0x6B, 0x56,
+        0xC7, 0xFA, 0xBD, 0x80, 0x33, 0x0E, 0x49, 0x74, 0x36, 0x0B, 0x4C, 0x71, 0xC2, 0xFF, 0xB8, 0x85,
+        0x3C, 0x01, 0x46, 0x7B, 0xC8, 0xF5, 0xB2, 0x8F, 0xCD, 0xF0, 0xB7, 0x8A, 0x39, 0x04, 0x43, 0x7E,
+        0x28, 0x15, 0x52, 0x6F, 0xDC, 0xE1, 0xA6, 0x9B, 0xD9, 0xE4, 0xA3, 0x9E, 0x2D, 0x10, 0x57, 0x6A,
+        0xD3, 0xEE, 0xA9, 0x94, 0x27, 0x1A, 0x5D, 0x60, 0x22, 0x1F, 0x58, 0x65, 0xD6, 0xEB, 0xAC, 0x91,
+        0x97, 0xAA, 0xED, 0xD0, 0x63, 0x5E, 0x19, 0x24, 0x66, 0x5B, 0x1C, 0x21, 0x92, 0xAF, 0xE8, 0xD5,
+        0x6C, 0x51, 0x16, 0x2B, 0x98, 0xA5, 0xE2, 0xDF, 0x9D, 0xA0, 0xE7, 0xDA, 0x69, 0x54, 0x13, 0x2E,
+        0x78, 0x45, 0x02, 0x3F, 0x8C, 0xB1, 0xF6, 0xCB, 0x89, 0xB4, 0xF3, 0xCE, 0x7D, 0x40, 0x07, 0x3A,
+        0x83, 0xBE, 0xF9, 0xC4, 0x77, 0x4A, 0x0D, 0x30, 0x72, 0x4F, 0x08, 0x35, 0x86, 0xBB, 0xFC, 0xC1,
+        0x50, 0x6D, 0x2A, 0x17, 0xA4, 0x99, 0xDE, 0xE3, 0xA1, 0x9C, 0xDB, 0xE6, 0x55, 0x68, 0x2F, 0x12,
+        0xAB, 0x96, 0xD1, 0xEC, 0x5F, 0x62, 0x25, 0x18, 0x5A, 0x67, 0x20, 0x1D, 0xAE, 0x93, 0xD4, 0xE9,
+        0xBF, 0x82, 0xC5, 0xF8, 0x4B, 0x76, 0x31, 0x0C, 0x4E, 0x73, 0x34, 0x09, 0xBA, 0x87, 0xC0, 0xFD,
+        0x44, 0x79, 0x3E, 0x03, 0xB0, 0x8D, 0xCA, 0xF7, 0xB5, 0x88, 0xCF, 0xF2, 0x41, 0x7C, 0x3B, 0x06,
+    },
+    {
+        0x00, 0x43, 0x86, 0xC5, 0x15, 0x56, 0x93, 0xD0, 0x2A, 0x69, 0xAC, 0xEF, 0x3F, 0x7C, 0xB9, 0xFA,
+        0x54, 0x17, 0xD2, 0x91, 0x41, 0x02, 0xC7, 0x84, 0x7E, 0x3D, 0xF8, 0xBB, 0x6B, 0x28, 0xED, 0xAE,
+        0xA8, 0xEB, 0x2E, 0x6D, 0xBD, 0xFE, 0x3B, 0x78, 0x82, 0xC1, 0x04, 0x47, 0x97, 0xD4, 0x11, 0x52,
+        0xFC, 0xBF, 0x7A, 0x39, 0xE9, 0xAA, 0x6F, 0x2C, 0xD6, 0x95, 0x50, 0x13, 0xC3, 0x80, 0x45, 0x06,
+        0x49, 0x0A, 0xCF, 0x8C, 0x5C, 0x1F, 0xDA, 0x99, 0x63, 0x20, 0xE5, 0xA6, 0x76, 0x35, 0xF0, 0xB3,
+        0x1D, 0x5E, 0x9B, 0xD8, 0x08, 0x4B, 0x8E, 0xCD, 0x37, 0x74, 0xB1, 0xF2, 0x22, 0x61, 0xA4, 0xE7,
+        0xE1, 0xA2, 0x67, 0x24, 0xF4, 0xB7, 0x72, 0x31, 0xCB, 0x88, 0x4D, 0x0E, 0xDE, 0x9D, 0x58, 0x1B,
+        0xB5, 0xF6, 0x33, 0x70, 0xA0, 0xE3, 0x26, 0x65, 0x9F, 0xDC, 0x19, 0x5A, 0x8A, 0xC9, 0x0C, 0x4F,
+        0x92, 0xD1, 0x14, 0x57, 0x87, 0xC4, 0x01, 0x42, 0xB8, 0xFB, 0x3E, 0x7D, 0xAD, 0xEE, 0x2B, 0x68,
+        0xC6, 0x85, 0x40, 0x03, 0xD3, 0x90, 0x55, 0x16, 0xEC, 0xAF, 0x6A, 0x29, 0xF9, 0xBA, 0x7F, 0x3C,
+        0x3A, 0x79, 0xBC, 0xFF, 0x2F, 0x6C, 0xA9, 0xEA, 0x10, 0x53, 0x96, 0xD5, 0x05, 0x46, 0x83, 0xC0,
+        0x6E, 0x2D, 0xE8, 0xAB, 0x7B, 0x38, 0xFD, 0xBE, 0x44, 0x07, 0xC2, 0x81, 0x51, 0x12, 0xD7, 0x94,
+        0xDB, 0x98, 0x5D, 0x1E, 0xCE, 0x8D, 0x48, 0x0B, 0xF1, 0xB2, 0x77, 0x34, 0xE4, 0xA7, 0x62, 0x21,
+        0x8F, 0xCC, 0x09, 0x4A, 0x9A, 0xD9, 0x1C, 0x5F, 0xA5, 0xE6, 0x23, 0x60, 0xB0, 0xF3, 0x36, 0x75,
+        0x73, 0x30, 0xF5, 0xB6, 0x66, 0x25, 0xE0, 0xA3, 0x59, 0x1A, 0xDF, 0x9C, 0x4C, 0x0F, 0xCA, 0x89,
+        0x27, 0x64, 0xA1, 0xE2, 0x32, 0x71, 0xB4, 0xF7, 0x0D, 0x4E, 0x8B, 0xC8, 0x18, 0x5B, 0x9E, 0xDD,
+    },
+#endif /* LWOW_CFG_CRC_TABLE >= 8 */
+};
+#endif /* LWOW_CFG_CRC_TABLE */
+
+/**
+ * \brief           Update CRC-8 with new input data
+ *
+ * Use this function to calculate CRC incrementally, while data are received from the bus.
+ * Start with `crc` set to `0`, final value equals \ref lwow_crc of all the data
+ *
+ * \param[in]       crc: Current CRC value
+ * \param[in]       inp: Input data
+ * \param[in]       len: Number of bytes
+ * \return          Updated CRC
+ * \note            This function is reentrant
+ */
+uint8_t
+lwow_crc_update(uint8_t crc, const void* inp, size_t len) {
+    const uint8_t* p_data = inp;
+
+    if (p_data == NULL || len == 0) {
+        return crc;
+    }
+
+#if LWOW_CFG_CRC_TABLE >= 8
+    for (; len >= 8U; len -= 8U, p_data += 8U) {
+        crc = crc8_table[7][crc ^ p_data[0]] ^ crc8_table[6][p_data[1]] ^ crc8_table[5][p_data[2]]
+              ^ crc8_table[4][p_data[3]] ^ crc8_table[3][p_data[4]] ^ crc8_table[2][p_data[5]]
+              ^ crc8_table[1][p_data[6]] ^ crc8_table[0][p_data[7]];
+    }
+#endif /* LWOW_CFG_CRC_TABLE >= 8 */
+#if LWOW_CFG_CRC_TABLE >= 4
+    for (; len >= 4U; len -= 4U, p_data += 4U) {
+        crc = crc8_table[3][crc ^ p_data[0]] ^ crc8_table[2][p_data[1]] ^ crc8_table[1][p_data[2]]
+              ^ crc8_table[0][p_data[3]];
+    }
+#endif /* LWOW_CFG_CRC_TABLE >= 4 */
+    for (; len > 0; --len, ++p_data) {
+#if LWOW_CFG_CRC_TABLE
+        crc = crc8_table[0][crc ^ *p_data];
+#else  /* LWOW_CFG_CRC_TABLE */
+        uint8_t inbyte = *p_data;
+        for (uint8_t j = 8U; j > 0; --j) {
+            uint8_t mix = (uint8_t)(crc ^ inbyte) & 0x01U;
+            crc >>= 1U;
+            if (mix > 0) {
+                crc ^= 0x8CU;
+            }
+            inbyte >>= 0x01U;
+        }
+#endif /* !LWOW_CFG_CRC_TABLE */
+    }
+    return crc;
+}
+
+/**
+ * \brief           Calculate CRC-8 of input data
+ * \param[in]       inp: Input data
+ * \param[in]       len: Number of bytes
+ * \return          Calculated CRC
+ * \note            This function is reentrant
+ */
+uint8_t
+lwow_crc(const void* inp, const size_t len) {
+    return lwow_crc_update(0, inp, len);
+}
+
+#if LWOW_CFG_CRC_TABLE
+/**
+ * \brief           CRC-16 lookup table, polynomial `0xA001` (reflected `x^16 + x^15 + x^2 + 1`)
+ */
+static const uint16_t crc16_table[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040,
+};
+#endif /* LWOW_CFG_CRC_TABLE */
+
+/**
+ * \brief           Update CRC-16 with new input data
+ *
+ * CRC-16 is used by memory and PIO devices to protect data pages and command sequences.
+ * Start with `crc` set to `0`, or with the value device specifies as seed
+ *
+ * \param[in]       crc: Current CRC value
+ * \param[in]       inp: Input data
+ * \param[in]       len: Number of bytes
+ * \return          Updated CRC
+ * \note            This function is reentrant
+ */
+uint16_t
+lwow_crc16_update(uint16_t crc, const void* inp, size_t len) {
+    const uint8_t* p_data = inp;
+
+    if (p_data == NULL || len == 0) {
+        return crc;
+    }
+
+    for (; len > 0; --len, ++p_data) {
+#if LWOW_CFG_CRC_TABLE
+        crc = (uint16_t)((crc >> 8U) ^ crc16_table[(uint8_t)(crc ^ *p_data)]);
+#else  /* LWOW_CFG_CRC_TABLE */
+        crc ^= *p_data;
+        for (uint8_t j = 8U; j > 0; --j) {
+            if ((crc & 0x01U) > 0) {
+                crc = (uint16_t)((crc >> 1U) ^ 0xA001U);
+            } else {
+                crc >>= 1U;
+            }
+        }
+#endif /* !LWOW_CFG_CRC_TABLE */
+    }
+    return crc;
+}
+
+/**
+ * \brief           Calculate CRC-16 of input data
+ * \param[in]       inp: Input data
+ * \param[in]       len: Number of bytes
+ * \return          Calculated CRC
+ * \note            This function is reentrant
+ */
+uint16_t
+lwow_crc16(const void* inp, const size_t len) {
+    return lwow_crc16_update(0, inp, len);
+}
+
+/**
+ * \brief           Check calculated CRC-16 against inverted CRC received from device
+ *
+ * Devices transmit inverted CRC-16, least significant byte first.
+ * Use it after \ref lwow_crc16_update has been applied to all data bytes
+ *
+ * \param[in]       crc: CRC-16 calculated over received data
+ * \param[in]       inv_crc: Pointer to `2` bytes of inverted CRC, as received from device
+ * \return          `1` if CRC matches, `0` otherwise
+ * \note            This function is reentrant
+ */
+uint8_t
+lwow_crc16_check_inv(uint16_t crc, const void* inv_crc) {
+    const uint8_t* p_crc = inv_crc;
+
+    LWOW_ASSERT0("inv_crc != NULL", inv_crc != NULL);
+
+    crc = (uint16_t)~crc;
+    return (uint8_t)(p_crc[0] == (uint8_t)crc && p_crc[1] == (uint8_t)(crc >> 8U));
+}
+
+/**
+ * \brief           Search devices on 1-wire network by using callback function and custom search command
+ *
+ * When new device is detected, callback function `func` is called to notify user
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       cmd: 1-Wire search command
+ * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
+ * \param[in]       func: Callback function to call for each device
+ * \param[in]       arg: Custom user argument, used in callback function
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_search_with_command_callback(lwow_t* const owobj, const uint8_t cmd, size_t* const roms_found,
+                                  const lwow_search_cb_fn func, void* arg) {
+    lwowr_t res = lwowERR;
+    lwow_rom_t rom_id = {0};
+    size_t idx = 0;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("func != NULL", func != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    /* Search device-by-device until all found */
+    for (idx = 0, res = lwow_search_reset_raw(owobj);
+         res == lwowOK && (res = lwow_search_with_command_raw(owobj, cmd, &rom_id)) == lwowOK; ++idx) {
+        res = func(owobj, &rom_id, idx, arg);
+        if (res != lwowOK) {
+            break;
+        }
+    }
+    func(owobj, NULL, idx, arg); /* Call with NULL rom_id parameter */
+    lwow_unprotect(owobj, 1U);
+    SET_NOT_NULL(roms_found, idx); /* Set number of roms found */
+    if (res == lwowERRNODEV) {     /* `No device` might not be an error, but simply no devices on bus */
+        res = lwowOK;
+    }
+    return res;
+}
+
+/**
+ * \brief           Search devices on 1-wire network by using callback function and `SEARCH_ROM` 1-Wire command
+ *
+ * When new device is detected, callback function `func` is called to notify user
+ *
+ * \param[in]       owobj: 1-Wire handle
+ * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
+ * \param[in]       func: Callback function to call for each device
+ * \param[in]       arg: Custom user argument, used in callback function
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_search_with_callback(lwow_t* const owobj, size_t* const roms_found, const lwow_search_cb_fn func, void* arg) {
+    return lwow_search_with_command_callback(owobj, LWOW_CMD_SEARCHROM, roms_found, func, arg);
+}
+
+/**
+ * \brief           Search for devices on 1-Wire network with command and store ROM IDs to input array
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       cmd: 1-Wire search command
+ * \param[in]       rom_id_arr: Pointer to output array to store found ROM IDs into
+ * \param[in]       rom_len: Length of input ROM array
+ * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_search_devices_with_command_raw(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id_arr,
+                                     const size_t rom_len, size_t* const roms_found) {
+    lwowr_t res = lwowERR;
+    size_t cnt = 0;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+
+    for (cnt = 0, res = lwow_search_reset_raw(owobj); cnt < rom_len; ++cnt) {
+        res = lwow_search_with_command_raw(owobj, cmd, &rom_id_arr[cnt]);
+        if (res != lwowOK) {
+            break;
+        }
+    }
+    SET_NOT_NULL(roms_found, cnt); /* Set number of roms found */
+    if (res == lwowERRNODEV && cnt > 0) {
+        res = lwowOK;
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_search_devices_with_command_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_search_devices_with_command(lwow_t* const owobj, const uint8_t cmd, lwow_rom_t* const rom_id_arr,
+                                 const size_t rom_len, size_t* const roms_found) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_devices_with_command_raw(owobj, cmd, rom_id_arr, rom_len, roms_found);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Search for devices on 1-Wire network with default command and store ROM IDs to input array
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       rom_id_arr: Pointer to output array to store found ROM IDs into
+ * \param[in]       rom_len: Length of input ROM array
+ * \param[out]      roms_found: Output variable to save number of found devices. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_search_devices_raw(lwow_t* const owobj, lwow_rom_t* const rom_id_arr, const size_t rom_len,
+                        size_t* const roms_found) {
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+
+    return lwow_search_devices_with_command_raw(owobj, LWOW_CMD_SEARCHROM, rom_id_arr, rom_len, roms_found);
+}
+
+/**
+ * \copydoc         lwow_search_devices_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_search_devices(lwow_t* const owobj, lwow_rom_t* const rom_id_arr, const size_t rom_len, size_t* const roms_found) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_devices_raw(owobj, rom_id_arr, rom_len, roms_found);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Verify if device with known ROM address is present on the bus
+ *
+ * Search state is set up to follow the path of `rom_id` only,
+ * hence single search pass is needed instead of full enumeration.
+ * Current search state is preserved, function can be called during device enumeration
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       rom_id: 1-Wire device address to verify
+ * \return          \ref lwowOK if device is present, \ref lwowERRNODEV if device is not present,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_verify_rom_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    lwow_rom_t rom;
+    uint8_t disrepancy, disrepancy_family, path_lost = 0, fallback = 0;
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    /* Save current search state */
+    rom = owobj->rom;
+    disrepancy = owobj->disrepancy;
+    disrepancy_family = owobj->disrepancy_family;
+
+    /* Without any discrepancy, search follows previous ROM address on every collision */
+    owobj->rom = *rom_id;
+    owobj->disrepancy = OW_LAST_DEV;
+    if (owobj->ll_drv->search_triplet != NULL) {
+        if ((res = lwow_reset_raw(owobj)) == lwowOK) {
+            res = prv_search_pass_triplet(owobj, LWOW_CMD_SEARCHROM, &fallback);
+        }
+        if (res == lwowOK && LWOW_MEMCMP(owobj->rom.rom, rom_id->rom, sizeof(rom_id->rom)) != 0) {
+            res = lwowERRNODEV;
+        }
+    }
+    if (owobj->ll_drv->search_triplet == NULL || fallback) {
+        res = prv_search_pass(owobj, LWOW_CMD_SEARCHROM, 64U, &path_lost);
+    }
+    prv_resume_update(owobj, res == lwowOK ? rom_id->rom : NULL); /* Verified device remains selected */
+
+    /* Restore search state */
+    owobj->rom = rom;
+    owobj->disrepancy = disrepancy;
+    owobj->disrepancy_family = disrepancy_family;
+    return res;
+}
+
+/**
+ * \copydoc         lwow_verify_rom_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_verify_rom(lwow_t* const owobj, const lwow_rom_t* const rom_id) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_verify_rom_raw(owobj, rom_id);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Verify presence of multiple devices with known ROM addresses
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       rom_id_arr: Array of ROM addresses to verify
+ * \param[in]       rom_len: Number of ROM addresses in array
+ * \param[out]      present: Output bitmap of at least `(rom_len + 7) / 8` bytes.
+ *                      Bit `n` is set to `1` when device `rom_id_arr[n]` is present, `0` otherwise
+ * \param[out]      present_cnt: Output variable to save number of present devices. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise.
+ *                      Missing devices are reported in `present` bitmap only
+ */
+lwowr_t
+lwow_verify_roms_raw(lwow_t* const owobj, const lwow_rom_t* const rom_id_arr, const size_t rom_len,
+                     uint8_t* const present, size_t* const present_cnt) {
+    lwowr_t res = lwowOK;
+    size_t cnt = 0;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+    LWOW_ASSERT("present != NULL", present != NULL);
+
+    LWOW_MEMSET(present, 0x00, (rom_len + 7U) / 8U);
+    for (size_t idx = 0; idx < rom_len; ++idx) {
+        res = lwow_verify_rom_raw(owobj, &rom_id_arr[idx]);
+        if (res == lwowOK) {
+            present[idx >> 0x03U] |= (uint8_t)(1U << (idx & 0x07U));
+            ++cnt;
+        } else if (res == lwowERRNODEV) {
+            res = lwowOK; /* Device not present is not an error */
+        } else if (res == lwowERRPRESENCE) {
+            res = lwowOK; /* No device on the bus at all */
+            break;
+        } else {
+            break;
+        }
+    }
+    SET_NOT_NULL(present_cnt, cnt);
+    return res;
+}
+
+/**
+ * \copydoc         lwow_verify_roms_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_verify_roms(lwow_t* const owobj, const lwow_rom_t* const rom_id_arr, const size_t rom_len,
+                 uint8_t* const present, size_t* const present_cnt) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+    LWOW_ASSERT("present != NULL", present != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_verify_roms_raw(owobj, rom_id_arr, rom_len, present, present_cnt);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Search for devices with specific family code and save them to array
+ *
+ * Search starts directly at requested family code and stops
+ * as soon as device with different family code is found
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       family: Family code, first byte of ROM address
+ * \param[in]       rom_id_arr: Pointer to output array to store found ROM IDs into
+ * \param[in]       rom_len: Length of input ROM array
+ * \param[out]      roms_found: Output pointer to save number of found devices. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_search_devices_by_family_raw(lwow_t* const owobj, const uint8_t family, lwow_rom_t* const rom_id_arr,
+                                  const size_t rom_len, size_t* const roms_found) {
+    lwowr_t res = lwowERR;
+    size_t cnt = 0;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+
+    for (cnt = 0, res = lwow_search_set_family_raw(owobj, family); cnt < rom_len; ++cnt) {
+        res = lwow_search_raw(owobj, &rom_id_arr[cnt]);
+        if (res == lwowOK && rom_id_arr[cnt].rom[0] != family) {
+            res = lwowERRNODEV; /* All devices of requested family have been found */
+        }
+        if (res != lwowOK) {
+            break;
+        }
+    }
+    SET_NOT_NULL(roms_found, cnt); /* Set number of roms found */
+    if (res == lwowERRNODEV && cnt > 0) {
+        res = lwowOK;
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_search_devices_by_family_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_search_devices_by_family(lwow_t* const owobj, const uint8_t family, lwow_rom_t* const rom_id_arr,
+                              const size_t rom_len, size_t* const roms_found) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("rom_id_arr != NULL", rom_id_arr != NULL);
+    LWOW_ASSERT("rom_len > 0", rom_len > 0);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_search_devices_by_family_raw(owobj, family, rom_id_arr, rom_len, roms_found);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Add new step to the transaction
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       type: Step type, member of \ref lwow_txn_step_type_t
+ * \param[in]       tx: Data to transmit, ROM to match or data to check
+ * \param[out]      rx: Output data for read step
+ * \param[in]       len: Number of bytes in the step
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_txn_add(lwow_txn_t* const txn, uint8_t type, const void* tx, void* rx, size_t len) {
+    lwow_txn_step_t* step;
+
+    if (txn->steps_cnt >= LWOW_ARRAYSIZE(txn->steps)) {
+        return lwowERR; /* No more space for new step */
+    }
+    step = &txn->steps[txn->steps_cnt++];
+    step->type = type;
+    step->byt = 0;
+    step->tx = tx;
+    step->rx = rx;
+    step->len = len;
+    return lwowOK;
+}
+
+/**
+ * \brief           Get byte to transmit for specific position of slot-based step
+ * \param[in]       step: Transaction step
+ * \param[in]       pos: Byte position in the step
+ * \return          Byte to write to the bus
+ */
+static uint8_t
+prv_txn_step_byte(const lwow_txn_step_t* step, size_t pos) {
+    const uint8_t* tx = step->tx;
+
+    switch (step->type) {
+        case LWOW_TXN_STEP_SELECT: {
+            if (tx == NULL) {
+                return LWOW_CMD_SKIPROM;
+            }
+            return pos == 0 ? LWOW_CMD_MATCHROM : tx[pos - 1U];
+        }
+        case LWOW_TXN_STEP_WRITE: return tx != NULL ? tx[pos] : step->byt;
+        default: return 0xFFU; /* Read operation */
+    }
+}
+
+/**
+ * \brief           Prepare next bus exchange of the transaction
+ *
+ * Function processes steps that do not need bus access (CRC check),
+ * and packs as many consecutive bit-slots as possible to the `trx` frame.
+ *
+ * \param[in,out]   txn: Transaction handle
+ * \param[out]      trx: Output frame with UART bytes, at least `8 * LWOW_CFG_TRX_BUFF_SIZE` bytes long
+ * \param[out]      len: Number of UART bytes written to `trx`.
+ *                      It is set to `0` when next step is reset or search or when transaction has finished
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_txn_prepare(lwow_txn_t* const txn, uint8_t* trx, size_t* len) {
+    size_t idx = txn->step_idx, pos = txn->step_pos, cnt = 0;
+
+    /* Process steps without bus access first */
+    for (; idx < txn->steps_cnt && txn->steps[idx].type == LWOW_TXN_STEP_CRC; ++idx) {
+        if (lwow_crc(txn->steps[idx].tx, txn->steps[idx].len) != 0) {
+            return lwowERRCRC;
+        }
+        txn->step_idx = idx + 1U;
+    }
+
+    /* Pack consecutive bytes from slot-based steps */
+    for (; idx < txn->steps_cnt && cnt < LWOW_CFG_TRX_BUFF_SIZE; ++idx, pos = 0) {
+        const lwow_txn_step_t* step = &txn->steps[idx];
+
+        if (step->type == LWOW_TXN_STEP_RESET || step->type == LWOW_TXN_STEP_SEARCH
+            || step->type == LWOW_TXN_STEP_CRC) {
+            break;
+        }
+        for (; pos < step->len && cnt < LWOW_CFG_TRX_BUFF_SIZE; ++pos, ++cnt) {
+            uint8_t byt = prv_txn_step_byte(step, pos);
+            for (uint8_t i = 0; i < 8U; ++i) {
+                trx[8U * cnt + i] = (byt & (1U << i)) ? 0xFFU : 0x00U;
+            }
+        }
+        if (pos < step->len) {
+            break; /* Frame is full */
+        }
+    }
+    *len = 8U * cnt;
+    return lwowOK;
+}
+
+/**
+ * \brief           Complete bus exchange, previously prepared with \ref prv_txn_prepare
+ *
+ * Received data are decoded and written to read steps, execution position is advanced.
+ *
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       trx: Received UART bytes
+ * \param[in]       len: Number of UART bytes in `trx`
+ */
+static void
+prv_txn_complete(lwow_txn_t* const txn, const uint8_t* trx, size_t len) {
+    size_t idx = txn->step_idx, pos = txn->step_pos;
+
+    for (size_t cnt = 0; cnt < len / 8U; ++cnt) {
+        const lwow_txn_step_t* step = &txn->steps[idx];
+
+        if (step->type == LWOW_TXN_STEP_READ) {
+            uint8_t tmp = 0U;
+            for (uint8_t i = 0; i < 8U; ++i) {
+                if (trx[8U * cnt + i] == 0xFFU) {
+                    tmp |= 0x01U << i;
+                }
+            }
+            ((uint8_t*)step->rx)[pos] = tmp;
+        }
+        if (++pos >= step->len) { /* Go to next step */
+            ++idx;
+            pos = 0;
+        }
+    }
+    txn->step_idx = idx;
+    txn->step_pos = pos;
+}
+
+/**
+ * \brief           Initialize (or clear) transaction
+ * \param[out]      txn: Transaction handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_init(lwow_txn_t* const txn) {
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    LWOW_MEMSET(txn, 0x00, sizeof(*txn));
+    return lwowOK;
+}
+
+/**
+ * \brief           Add reset step to the transaction
+ *
+ * Transaction execution stops with \ref lwowERRPRESENCE if no device responds to reset
+ *
+ * \param[in,out]   txn: Transaction handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_add_reset(lwow_txn_t* const txn) {
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    return prv_txn_add(txn, LWOW_TXN_STEP_RESET, NULL, NULL, 0);
+}
+
+/**
+ * \brief           Add select step to the transaction
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       rom_id: 1-Wire device address to match device or `NULL` to skip the match
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_add_select(lwow_txn_t* const txn, const lwow_rom_t* const rom_id) {
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    return prv_txn_add(txn, LWOW_TXN_STEP_SELECT, rom_id != NULL ? rom_id->rom : NULL, NULL,
+                       rom_id != NULL ? 1U + sizeof(rom_id->rom) : 1U);
+}
+
+/**
+ * \brief           Add write step to the transaction
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       btw: Array of bytes to write
+ * \param[in]       len: Number of bytes to write
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_add_write(lwow_txn_t* const txn, const void* const btw, const size_t len) {
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+    LWOW_ASSERT("btw != NULL", btw != NULL);
+    LWOW_ASSERT("len > 0", len > 0);
+
+    return prv_txn_add(txn, LWOW_TXN_STEP_WRITE, btw, NULL, len);
+}
+
+/**
+ * \brief           Add single byte write step to the transaction
+ *
+ * Byte value is copied to the transaction, hence no external memory is required.
+ * This is useful to send commands to the device
+ *
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       btw: Byte to write
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_add_write_byte(lwow_txn_t* const txn, const uint8_t btw) {
+    lwowr_t res;
+
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    if ((res = prv_txn_add(txn, LWOW_TXN_STEP_WRITE, NULL, NULL, 1U)) == lwowOK) {
+        txn->steps[txn->steps_cnt - 1U].byt = btw;
+    }
+    return res;
+}
+
+/**
+ * \brief           Add read step to the transaction
+ * \param[in,out]   txn: Transaction handle
+ * \param[out]      byr: Array to save read values to
+ * \param[in]       len: Number of bytes to read
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_add_read(lwow_txn_t* const txn, void* const byr, const size_t len) {
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+    LWOW_ASSERT("byr != NULL", byr != NULL);
+    LWOW_ASSERT("len > 0", len > 0);
+
+    return prv_txn_add(txn, LWOW_TXN_STEP_READ, NULL, byr, len);
+}
+
+/**
+ * \brief           Add CRC check step to the transaction
+ *
+ * CRC-8 is calculated over `len` bytes, including CRC byte itself, and must result in `0`.
+ * Transaction execution stops with \ref lwowERRCRC on mismatch.
+ * Data are typically output of previous read step.
+ *
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       data: Data to check
+ * \param[in]       len: Number of bytes, including CRC byte
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_add_crc_check(lwow_txn_t* const txn, const void* const data, const size_t len) {
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+    LWOW_ASSERT("data != NULL", data != NULL);
+    LWOW_ASSERT("len > 0", len > 0);
+
+    return prv_txn_add(txn, LWOW_TXN_STEP_CRC, data, NULL, len);
+}
+
+/**
+ * \brief           Add search step to the transaction
+ *
+ * Step performs single search pass, equal to \ref lwow_search_with_command_raw,
+ * and must be preceded by reset step.
+ * Low-level `search_triplet` function is used when available, except for asynchronous transactions
+ * driven by `tx_rx_start`, where known bits of previous search are exchanged in batches
+ * and remaining bits one per exchange.
+ * Search state is kept in 1-Wire instance, hence transaction finds next device each time it is executed.
+ * Transaction execution stops with \ref lwowERRNODEV when there are no more devices.
+ *
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       cmd: Command to use for search operation
+ * \param[out]      rom_id: Pointer to ROM structure to store address
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_add_search(lwow_txn_t* const txn, const uint8_t cmd, lwow_rom_t* const rom_id) {
+    lwowr_t res;
+
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    if ((res = prv_txn_add(txn, LWOW_TXN_STEP_SEARCH, NULL, rom_id, 64U)) == lwowOK) {
+        txn->steps[txn->steps_cnt - 1U].byt = cmd;
+    }
+    return res;
+}
+
+/**
+ * \brief           Finish search step, after search pass has been completed
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       found: Set to `1` if device has been found, `0` otherwise
+ * \return          \ref lwowOK on success, \ref lwowERRNODEV if there is no device
+ */
+static lwowr_t
+prv_txn_search_finish(lwow_t* const owobj, lwow_txn_t* const txn, const uint8_t found) {
+    const lwow_txn_step_t* step = &txn->steps[txn->step_idx];
+
+    LWOW_MEMCPY(step->rx, owobj->rom.rom, sizeof(owobj->rom.rom));
+    txn->srch_nobatch = 0;
+    txn->srch_uart = 0;
+    if (!found) {
+        return lwowERRNODEV;
+    }
+    if (step->byt == LWOW_CMD_SEARCHROM && txn->srch_first) {
+        owobj->single_drop = owobj->disrepancy == OW_LAST_DEV;
+    }
+    ++txn->step_idx;
+    txn->step_pos = 0;
+    return lwowOK;
+}
+
+/**
+ * \brief           Execute search step with low-level search triplet function, in blocking mode
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_txn_search_triplet(lwow_t* const owobj, lwow_txn_t* const txn) {
+    lwowr_t res;
+    uint8_t fallback;
+
+    if (owobj->disrepancy == 0) {
+        lwow_search_reset_raw(owobj);
+        return lwowERRNODEV;
+    }
+    txn->srch_first = owobj->disrepancy == OW_FIRST_DEV;
+    if ((res = prv_search_pass_triplet(owobj, txn->steps[txn->step_idx].byt, &fallback)) != lwowOK
+        && res != lwowERRNODEV) {
+        if (fallback && txn->step_idx > 0 && txn->steps[txn->step_idx - 1U].type == LWOW_TXN_STEP_RESET) {
+            /* Speed is not supported by driver, repeat reset and search with UART slots */
+            txn->srch_uart = 1;
+            --txn->step_idx;
+            txn->step_pos = 0;
+            return lwowOK;
+        }
+        return res;
+    }
+    return prv_txn_search_finish(owobj, txn, res == lwowOK);
+}
+
+/**
+ * \brief           Prepare next bus exchange of search step
+ *
+ * Search step uses the same approach as \ref lwow_search_with_command_raw:
+ * bits before last disrepancy position follow path of previous device
+ * and are exchanged in batches of read, complement and direction slots.
+ * Remaining bits are exchanged one at a time: direction of previous bit
+ * is written together with next bit and its complement.
+ *
+ * Step position is `0` before search command is sent and `1 + number of decided bits` afterwards
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle
+ * \param[out]      trx: Output frame with UART bytes
+ * \param[out]      len: Number of UART bytes written to `trx`
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_txn_search_prepare(lwow_t* const owobj, lwow_txn_t* const txn, uint8_t* trx, size_t* len) {
+    const lwow_txn_step_t* step = &txn->steps[txn->step_idx];
+    uint8_t* idd = owobj->rom.rom;
+    size_t cnt = 0;
+    uint8_t pos = txn->step_pos > 0 ? (uint8_t)(txn->step_pos - 1U) : 0, num = 0;
+
+    if (txn->step_pos == 0) {
+        /* Check for last device */
+        if (owobj->disrepancy == 0) {
+            lwow_search_reset_raw(owobj);
+            return lwowERRNODEV;
+        }
+        txn->srch_first = owobj->disrepancy == OW_FIRST_DEV;
+        txn->srch_disrepancy = OW_LAST_DEV;
+        txn->srch_disrepancy_family = OW_LAST_DEV;
+
+        /* Known path is used only when search can be repeated bit by bit, after preceding reset step */
+        txn->srch_known = 0;
+        if (!txn->srch_nobatch && !txn->srch_first && txn->step_idx > 0
+            && txn->steps[txn->step_idx - 1U].type == LWOW_TXN_STEP_RESET) {
+            txn->srch_known = 64U - owobj->disrepancy;
+        }
+        for (uint8_t i = 0; i < 8U; ++i) {
+            trx[cnt++] = (step->byt & (1U << i)) ? 0xFFU : 0x00U;
+        }
+    } else if (pos > txn->srch_known) {
+        trx[cnt++] = ROM_BIT_GET(idd, pos - 1U) ? 0xFFU : 0x00U; /* Direction of previous bit */
+    }
+
+    /* Bits with known direction */
+    for (; pos + num < txn->srch_known && cnt + 3U <= LWOW_TXN_TRX_LEN; ++num) {
+        trx[cnt++] = 0xFFU;
+        trx[cnt++] = 0xFFU;
+        trx[cnt++] = ROM_BIT_GET(idd, pos + num) ? 0xFFU : 0x00U;
+    }
+    txn->srch_batch = num;
+
+    /* Next unknown bit and its complement */
+    txn->srch_read = pos + num >= txn->srch_known && pos + num < 64U && cnt + 2U <= LWOW_TXN_TRX_LEN;
+    if (txn->srch_read) {
+        trx[cnt++] = 0xFFU;
+        trx[cnt++] = 0xFFU;
+    }
+    *len = cnt;
+    return prv_set_baudrate(owobj, owobj->speed == LWOW_SPEED_OVERDRIVE ? LWOW_CFG_OD_BAUD_DATA : OW_BAUD_DATA);
+}
+
+/**
+ * \brief           Complete bus exchange of search step
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       trx: Received UART bytes
+ * \param[in]       len: Number of UART bytes in `trx`
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_txn_search_complete(lwow_t* const owobj, lwow_txn_t* const txn, const uint8_t* trx, size_t len) {
+    uint8_t* idd = owobj->rom.rom;
+    uint8_t pos = txn->step_pos > 0 ? (uint8_t)(txn->step_pos - 1U) : 0;
+    const uint8_t* p = &trx[len - 3U * txn->srch_batch - (txn->srch_read ? 2U : 0U)];
+
+    for (uint8_t num = txn->srch_batch; num > 0; --num, ++pos, p += 3) {
+        uint8_t bit = p[0] == 0xFFU, b_cpl = p[1] == 0xFFU, dir = ROM_BIT_GET(idd, pos);
+
+        /* Devices on known path did not respond, repeat search bit by bit after new reset */
+        if ((bit && b_cpl) || (bit != b_cpl && bit != dir)) {
+            txn->srch_nobatch = 1;
+            --txn->step_idx;
+            txn->step_pos = 0;
+            return lwowOK;
+        }
+        if (!bit && !b_cpl && dir) {
+            txn->srch_disrepancy = 64U - pos; /* Other way is still to be searched */
+            if (txn->srch_disrepancy >= OW_FAMILY_MIN) {
+                txn->srch_disrepancy_family = txn->srch_disrepancy;
+            }
+        }
+    }
+    if (txn->srch_read) {
+        uint8_t bit = p[0] == 0xFFU, b_cpl = p[1] == 0xFFU, id_bit_number = 64U - pos;
+
+        if (bit && b_cpl) {
+            /* No device responded, search pass finished without device */
+            owobj->disrepancy = txn->srch_disrepancy;
+            owobj->disrepancy_family = txn->srch_disrepancy_family;
+            return prv_txn_search_finish(owobj, txn, 0);
+        }
+
+        /* Collision follows the same rules as for blocking search */
+        if (!bit && !b_cpl
+            && (id_bit_number < owobj->disrepancy || (ROM_BIT_GET(idd, pos) && owobj->disrepancy != id_bit_number))) {
+            bit = 1;
+            txn->srch_disrepancy = id_bit_number;
+            if (id_bit_number >= OW_FAMILY_MIN) {
+                txn->srch_disrepancy_family = id_bit_number;
+            }
+        }
+        if (bit) {
+            idd[pos >> 0x03U] |= (uint8_t)(1U << (pos & 0x07U));
+        } else {
+            idd[pos >> 0x03U] &= (uint8_t)~(1U << (pos & 0x07U));
+        }
+        ++pos;
+    } else if (pos == 64U) {
+        /* Direction of last bit has been sent, device found */
+        owobj->disrepancy = txn->srch_disrepancy;
+        owobj->disrepancy_family = txn->srch_disrepancy_family;
+        return prv_txn_search_finish(owobj, txn, 1);
+    }
+    txn->step_pos = pos + 1U;
+    return lwowOK;
+}
+
+#if LWOW_CFG_ASYNC
+/* Native reset and search triplet block, they are not used when exchanges are completed from driver context */
+#define prv_txn_is_async(owobj, txn) ((owobj)->async_txn == (txn) && (owobj)->ll_drv->tx_rx_start != NULL)
+#else
+#define prv_txn_is_async(owobj, txn) 0
+#endif /* LWOW_CFG_ASYNC */
+
+/**
+ * \brief           Start transaction execution with step-by-step API
+ *
+ * Transaction is executed as resumable state machine, driven by the caller:
+ * \ref lwow_txn_prepare_raw returns UART bytes to exchange,
+ * caller exchanges them with the bus in any way (blocking, non-blocking, event-driven),
+ * and passes received bytes back with \ref lwow_txn_complete_raw.
+ * This allows single thread to drive many buses at the same time.
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_start_raw(lwow_t* const owobj, lwow_txn_t* const txn) {
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    txn->step_idx = 0;
+    txn->step_pos = 0;
+    txn->srch_nobatch = 0;
+    txn->srch_uart = 0;
+    prv_resume_update(owobj, NULL); /* Set again when transaction finishes successfully */
+    return lwowOK;
+}
+
+/**
+ * \brief           Prepare next bus exchange of the transaction
+ *
+ * Baudrate for the exchange is set with low-level driver before function returns,
+ * UART bytes must then be exchanged (written and the same number read back) by the caller.
+ *
+ * \note            Reset steps are executed synchronously within the function,
+ *                  when low-level driver implements native `reset` function
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle, started with \ref lwow_txn_start_raw
+ * \param[out]      trx: Output frame with UART bytes, at least \ref LWOW_TXN_TRX_LEN bytes long
+ * \param[out]      len: Number of UART bytes to exchange.
+ *                      It is set to `0` when transaction has finished successfully
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_prepare_raw(lwow_t* const owobj, lwow_txn_t* const txn, uint8_t* const trx, size_t* const len) {
+    lwowr_t res;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+    LWOW_ASSERT("trx != NULL", trx != NULL);
+    LWOW_ASSERT("len != NULL", len != NULL);
+
+    while ((res = prv_txn_prepare(txn, trx, len)) == lwowOK && txn->step_idx < txn->steps_cnt) {
+        if (*len > 0) {
+            return prv_set_baudrate(owobj,
+                                    owobj->speed == LWOW_SPEED_OVERDRIVE ? LWOW_CFG_OD_BAUD_DATA : OW_BAUD_DATA);
+        }
+
+        /* Only reset and search steps have no slots packed */
+        if (txn->steps[txn->step_idx].type == LWOW_TXN_STEP_SEARCH) {
+            if (owobj->ll_drv->search_triplet == NULL || txn->srch_uart || prv_txn_is_async(owobj, txn)) {
+                return prv_txn_search_prepare(owobj, txn, trx, len);
+            }
+            if ((res = prv_txn_search_triplet(owobj, txn)) != lwowOK) {
+                return res;
+            }
+            continue;
+        }
+        if (owobj->ll_drv->reset == NULL || prv_txn_is_async(owobj, txn)) {
+            trx[0] = OW_RESET_BYTE;
+            *len = 1U;
+            return prv_set_baudrate(owobj,
+                                    owobj->speed == LWOW_SPEED_OVERDRIVE ? LWOW_CFG_OD_BAUD_RESET : OW_BAUD_RESET);
+        }
+        if ((res = lwow_reset_raw(owobj)) != lwowOK) {
+            return res;
+        }
+        ++txn->step_idx;
+    }
+    if (res == lwowOK) {
+        /* Last executed select or search step defines device, selected for resume */
+        for (size_t idx = txn->step_idx; idx > 0; --idx) {
+            if (txn->steps[idx - 1U].type == LWOW_TXN_STEP_SELECT) {
+                prv_resume_update(owobj, txn->steps[idx - 1U].tx);
+                break;
+            } else if (txn->steps[idx - 1U].type == LWOW_TXN_STEP_SEARCH) {
+                prv_resume_update(owobj, owobj->rom.rom);
+                break;
+            }
+        }
+    }
+    *len = 0;
+    return res;
+}
+
+/**
+ * \brief           Complete bus exchange, previously prepared with \ref lwow_txn_prepare_raw
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle
+ * \param[in]       trx: Received UART bytes
+ * \param[in]       len: Number of received UART bytes, must be equal to prepared length
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_complete_raw(lwow_t* const owobj, lwow_txn_t* const txn, const uint8_t* const trx, const size_t len) {
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+    LWOW_ASSERT("trx != NULL", trx != NULL);
+    LWOW_ASSERT("txn->step_idx < txn->steps_cnt", txn->step_idx < txn->steps_cnt);
+
+    if (txn->steps[txn->step_idx].type == LWOW_TXN_STEP_SEARCH) {
+        return prv_txn_search_complete(owobj, txn, trx, len);
+    } else if (txn->steps[txn->step_idx].type != LWOW_TXN_STEP_RESET) {
+        prv_txn_complete(txn, trx, len);
+        return lwowOK;
+    }
+
+    /* Check if there is reply from any device */
+    if (len == 1U && trx[0] != 0 && trx[0] != OW_RESET_BYTE) {
+        ++txn->step_idx;
+        return lwowOK;
+    }
+    if (owobj->speed == LWOW_SPEED_OVERDRIVE) {
+        owobj->speed = LWOW_SPEED_STANDARD; /* Repeat the reset at standard speed */
+        return lwowOK;
+    }
+    return lwowERRPRESENCE;
+}
+
+/**
+ * \brief           Execute all steps of the transaction
+ *
+ * Consecutive select, write and read steps are merged together
+ * and exchanged with minimum number of low-level calls.
+ * Transaction can be executed many times.
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_execute_raw(lwow_t* const owobj, lwow_txn_t* const txn) {
+    uint8_t trx[LWOW_TXN_TRX_LEN];
+    lwowr_t res;
+    size_t len = 0;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    res = lwow_txn_start_raw(owobj, txn);
+    while (res == lwowOK && (res = lwow_txn_prepare_raw(owobj, txn, trx, &len)) == lwowOK && len > 0) {
+        if (!owobj->ll_drv->tx_rx(trx, trx, len, owobj->arg)) {
+            res = lwowERRTXRX;
+        } else {
+            res = lwow_txn_complete_raw(owobj, txn, trx, len);
+        }
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_txn_execute_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_txn_execute(lwow_t* const owobj, lwow_txn_t* const txn) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_txn_execute_raw(owobj, txn);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+#if LWOW_CFG_ASYNC || __DOXYGEN__
+
+/*
+ * Exchange hand-off states. Caller of `tx_rx_start` and `done_fn` race for the transition out of
+ * `PRV_ASYNC_STARTING` with atomic compare-and-swap, the one that loses continues the transaction
+ */
+#define PRV_ASYNC_STARTING 0x01U /* `tx_rx_start` is being called */
+#define PRV_ASYNC_WAITING  0x02U /* Driver returned, `done_fn` continues the transaction */
+#define PRV_ASYNC_DONE     0x03U /* Exchange finished before driver returned, caller continues the transaction */
+
+static void prv_async_run(lwow_t* const owobj, lwowr_t res);
+
+/**
+ * \brief           Exchange finished notification from low-level driver
+ * \param[in]       ctx: 1-Wire handle
+ * \param[in]       success: `1` if all bytes have been exchanged, `0` otherwise
+ */
+static void
+prv_async_done(void* ctx, uint8_t success) {
+    lwow_t* owobj = ctx;
+
+    owobj->async_ok = success;
+    if (LWOW_ASYNC_CAS(&owobj->async_state, PRV_ASYNC_STARTING, PRV_ASYNC_DONE)) {
+        return; /* Finished before driver returned, continue in the caller */
+    }
+    prv_async_run(owobj, success ? lwow_txn_complete_raw(owobj, owobj->async_txn, owobj->async_trx, owobj->async_len)
+                                 : lwowERRTXRX);
+}
+
+/**
+ * \brief           Advance asynchronous transaction until next exchange is started or transaction finishes
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in]       res: Result of previous step
+ */
+static void
+prv_async_run(lwow_t* const owobj, lwowr_t res) {
+    lwow_txn_t* txn = owobj->async_txn;
+
+    while (res == lwowOK
+           && (res = lwow_txn_prepare_raw(owobj, txn, owobj->async_trx, &owobj->async_len)) == lwowOK
+           && owobj->async_len > 0) {
+        /* Blocking drivers complete exchange immediately */
+        if (owobj->ll_drv->tx_rx_start == NULL) {
+            if (owobj->ll_drv->tx_rx(owobj->async_trx, owobj->async_trx, owobj->async_len, owobj->arg)) {
+                res = lwow_txn_complete_raw(owobj, txn, owobj->async_trx, owobj->async_len);
+            } else {
+                res = lwowERRTXRX;
+            }
+            continue;
+        }
+
+        owobj->async_state = PRV_ASYNC_STARTING;
+        if (!owobj->ll_drv->tx_rx_start(owobj->async_trx, owobj->async_trx, owobj->async_len, prv_async_done, owobj,
+                                        owobj->arg)) {
+            res = lwowERRTXRX;
+            break;
+        }
+        if (LWOW_ASYNC_CAS(&owobj->async_state, PRV_ASYNC_STARTING, PRV_ASYNC_WAITING)) {
+            return; /* Transaction continues when driver reports finished exchange */
+        }
+        res = owobj->async_ok ? lwow_txn_complete_raw(owobj, txn, owobj->async_trx, owobj->async_len) : lwowERRTXRX;
+    }
+
+    owobj->async_txn = NULL;
+    if (owobj->async_fn != NULL) {
+        owobj->async_fn(owobj, res, owobj->async_arg);
+    }
+}
+
+/**
+ * \brief           Start transaction execution in background
+ *
+ * Reset, select, search, write and read steps are executed as resumable state machine
+ * on top of `tx_rx_start` low-level driver function, so CPU is free while exchange is in progress on the bus.
+ * Drivers without `tx_rx_start` function are supported with blocking `tx_rx` function,
+ * in which case transaction finishes before function returns.
+ *
+ * Callback is called from the context, where driver reports finished exchange, possibly interrupt.
+ * Instance stays busy until transaction finishes, thread-safe functions return \ref lwowERRBUSY meanwhile.
+ * Functions without protection (`_raw` suffix) must not be used.
+ *
+ * \note            Function must not be called from `fn` callback, as it waits for instance mutex
+ *                      in \ref LWOW_CFG_OS mode. Start next transaction from thread context instead
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   txn: Transaction to execute. It must stay valid until it finishes
+ * \param[in]       fn: Transaction finished callback. Set to `NULL` if not used
+ * \param[in]       arg: Custom argument passed to callback function
+ * \return          \ref lwowOK if transaction started, \ref lwowERRBUSY if another one is pending,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_txn_execute_async(lwow_t* const owobj, lwow_txn_t* const txn, lwow_async_fn fn, void* arg) {
+    lwowr_t res = lwowOK;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res; /* Another transaction is pending */
+    }
+    owobj->async_txn = txn;
+    owobj->async_fn = fn;
+    owobj->async_arg = arg;
+    lwow_unprotect(owobj, 1U);
+    prv_async_run(owobj, lwow_txn_start_raw(owobj, txn));
+    return lwowOK;
+}
+
+/**
+ * \brief           Check if asynchronous transaction is pending on the instance
+ * \param[in]       owobj: 1-Wire handle
+ * \return          `1` if transaction is pending, `0` otherwise
+ */
+uint8_t
+lwow_txn_is_pending(lwow_t* const owobj) {
+    LWOW_ASSERT0("owobj != NULL", owobj != NULL);
+
+    return owobj->async_txn != NULL;
+}
+
+#endif /* LWOW_CFG_ASYNC || __DOXYGEN__ */
@@ -0,0 +1,305 @@
+/**
+ * \file            lwow_group.c
+ * \brief           Bus group executor implementation
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#include <stdint.h>
+#include <string.h>
+#include "lwow/lwow.h"
+#include "lwow/lwow_group.h"
+#include "system/lwow_sys.h"
+
+#if LWOW_CFG_GROUP || __DOXYGEN__
+
+#if !LWOW_CFG_OS
+#error "LWOW_CFG_GROUP requires LWOW_CFG_OS to be enabled"
+#endif /* !LWOW_CFG_OS */
+
+/* Set value if not NULL */
+#define SET_NOT_NULL(p, v)                                                                                             \
+    if ((p) != NULL) {                                                                                                 \
+        *(p) = (v);                                                                                                    \
+    }
+
+/**
+ * \brief           Worker thread function
+ *
+ * Worker waits for work, processes all buses with affinity to the worker
+ * and notifies the caller when finished
+ *
+ * \param[in]       thread_arg: Worker handle
+ */
+static void
+prv_worker_thread(void* thread_arg) {
+    lwow_group_worker_t* w = thread_arg;
+    lwow_group_t* grp = w->grp;
+
+    while (lwow_sys_sem_wait(&w->sem_work, grp->arg) && !grp->stop) {
+        for (size_t idx = w->idx; idx < grp->buses_cnt; idx += grp->workers_cnt) {
+            if ((grp->status[idx] = lwow_protect(&grp->buses[idx], 1U)) == lwowOK) {
+                grp->status[idx] = grp->fn(&grp->buses[idx], idx, grp->fn_arg);
+                lwow_unprotect(&grp->buses[idx], 1U);
+            }
+        }
+        lwow_sys_sem_release(&grp->sem_done, grp->arg);
+    }
+    lwow_sys_sem_release(&grp->sem_done, grp->arg); /* Notify that thread is finishing */
+}
+
+/**
+ * \brief           Stop and release all worker threads created so far
+ * \param[in,out]   grp: Group handle
+ */
+static void
+prv_workers_stop(lwow_group_t* const grp) {
+    grp->stop = 1;
+    for (size_t idx = 0; idx < grp->workers_cnt; ++idx) {
+        lwow_sys_sem_release(&grp->workers[idx].sem_work, grp->arg);
+    }
+    for (size_t idx = 0; idx < grp->workers_cnt; ++idx) {
+        lwow_sys_sem_wait(&grp->sem_done, grp->arg);
+    }
+    for (size_t idx = 0; idx < grp->workers_cnt; ++idx) {
+        lwow_sys_sem_delete(&grp->workers[idx].sem_work, grp->arg);
+    }
+    grp->workers_cnt = 0;
+}
+
+/**
+ * \brief           Work function to execute transaction, one for every bus
+ * \param[in]       owobj: 1-Wire handle
+ * \param[in]       bus_idx: Index of the bus in the group
+ * \param[in]       arg: Array of transactions
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_work_txn(lwow_t* const owobj, const size_t bus_idx, void* arg) {
+    lwow_txn_t* txn = &((lwow_txn_t*)arg)[bus_idx];
+
+    return txn->steps_cnt > 0 ? lwow_txn_execute_raw(owobj, txn) : lwowOK;
+}
+
+/**
+ * \brief           Initialize bus group and start worker threads
+ * \param[out]      grp: Group handle
+ * \param[in]       workers_cnt: Number of worker threads, up to \ref LWOW_CFG_GROUP_MAX_WORKERS
+ * \param[in]       arg: Custom argument, passed to system functions
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_group_init(lwow_group_t* const grp, const size_t workers_cnt, void* arg) {
+    LWOW_ASSERT("grp != NULL", grp != NULL);
+    LWOW_ASSERT("workers_cnt > 0", workers_cnt > 0);
+    LWOW_ASSERT("workers_cnt <= LWOW_CFG_GROUP_MAX_WORKERS", workers_cnt <= LWOW_CFG_GROUP_MAX_WORKERS);
+
+    LWOW_MEMSET(grp, 0x00, sizeof(*grp));
+    grp->arg = arg;
+    if (!lwow_sys_mutex_create(&grp->mutex, arg)) {
+        return lwowERR;
+    }
+    if (!lwow_sys_sem_create(&grp->sem_done, 0, arg)) {
+        lwow_sys_mutex_delete(&grp->mutex, arg);
+        return lwowERR;
+    }
+
+    /* Create worker threads */
+    for (size_t idx = 0; idx < workers_cnt; ++idx) {
+        lwow_group_worker_t* w = &grp->workers[idx];
+
+        w->grp = grp;
+        w->idx = idx;
+        if (!lwow_sys_sem_create(&w->sem_work, 0, arg)) {
+            break;
+        }
+        if (!lwow_sys_thread_create(prv_worker_thread, w, arg)) {
+            lwow_sys_sem_delete(&w->sem_work, arg);
+            break;
+        }
+        ++grp->workers_cnt;
+    }
+    if (grp->workers_cnt != workers_cnt) {
+        prv_workers_stop(grp);
+        lwow_sys_sem_delete(&grp->sem_done, arg);
+        lwow_sys_mutex_delete(&grp->mutex, arg);
+        return lwowERR;
+    }
+    return lwowOK;
+}
+
+/**
+ * \brief           Stop worker threads and de-initialize all buses in the group
+ * \param[in,out]   grp: Group handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_group_deinit(lwow_group_t* const grp) {
+    LWOW_ASSERT("grp != NULL", grp != NULL);
+
+    lwow_sys_mutex_wait(&grp->mutex, grp->arg);
+    prv_workers_stop(grp);
+    for (size_t idx = 0; idx < grp->buses_cnt; ++idx) {
+        lwow_deinit(&grp->buses[idx]);
+    }
+    grp->buses_cnt = 0;
+    lwow_sys_sem_delete(&grp->sem_done, grp->arg);
+    lwow_sys_mutex_release(&grp->mutex, grp->arg);
+    lwow_sys_mutex_delete(&grp->mutex, grp->arg);
+    return lwowOK;
+}
+
+/**
+ * \brief           Initialize new 1-Wire instance and add it to the group
+ * \param[in,out]   grp: Group handle
+ * \param[in]       ll_drv: Low-level driver
+ * \param[in]       arg: Custom argument, passed to \ref lwow_init function
+ * \param[out]      bus_idx: Output variable to save bus index to. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, \ref lwowERRMEM if group is full,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_group_add_bus(lwow_group_t* const grp, const lwow_ll_drv_t* const ll_drv, void* arg, size_t* const bus_idx) {
+    lwowr_t res = lwowERRMEM;
+
+    LWOW_ASSERT("grp != NULL", grp != NULL);
+    LWOW_ASSERT("ll_drv != NULL", ll_drv != NULL);
+
+    lwow_sys_mutex_wait(&grp->mutex, grp->arg);
+    if (grp->buses_cnt < LWOW_CFG_GROUP_MAX_BUSES
+        && (res = lwow_init(&grp->buses[grp->buses_cnt], ll_drv, arg)) == lwowOK) {
+        SET_NOT_NULL(bus_idx, grp->buses_cnt);
+        ++grp->buses_cnt;
+    }
+    lwow_sys_mutex_release(&grp->mutex, grp->arg);
+    return res;
+}
+
+/**
+ * \brief           Get 1-Wire instance of the bus
+ *
+ * Instance may be used with regular thread-safe functions, also while group executes work
+ *
+ * \param[in]       grp: Group handle
+ * \param[in]       bus_idx: Index of the bus in the group
+ * \return          1-Wire handle on success, `NULL` otherwise
+ */
+lwow_t*
+lwow_group_get_bus(lwow_group_t* const grp, const size_t bus_idx) {
+    LWOW_ASSERT0("grp != NULL", grp != NULL);
+    LWOW_ASSERT0("bus_idx < grp->buses_cnt", bus_idx < grp->buses_cnt);
+
+    return &grp->buses[bus_idx];
+}
+
+/**
+ * \brief           Get number of buses in the group
+ * \param[in]       grp: Group handle
+ * \return          Number of buses
+ */
+size_t
+lwow_group_get_bus_count(const lwow_group_t* const grp) {
+    LWOW_ASSERT0("grp != NULL", grp != NULL);
+
+    return grp->buses_cnt;
+}
+
+/**
+ * \brief           Execute work function on all buses in parallel and wait for completion
+ *
+ * Work function is called once for every bus, from worker thread with affinity to the bus.
+ * Only one work may be executed at a time, concurrent calls are serialized
+ *
+ * \param[in,out]   grp: Group handle
+ * \param[in]       fn: Work function
+ * \param[in]       arg: Custom argument, passed to work function
+ * \param[out]      status: Output array of at least `buses_cnt` elements to save result of every bus to.
+ *                      Set to `NULL` if not used
+ * \param[out]      ok_cnt: Output variable to save number of buses with successful result.
+ *                      Set to `NULL` if not used
+ * \return          \ref lwowOK if work succeeded on all buses, \ref lwowERR if it failed on any bus,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_group_execute(lwow_group_t* const grp, lwow_group_work_fn fn, void* arg, lwowr_t* const status,
+                   size_t* const ok_cnt) {
+    size_t cnt = 0;
+
+    LWOW_ASSERT("grp != NULL", grp != NULL);
+    LWOW_ASSERT("fn != NULL", fn != NULL);
+
+    lwow_sys_mutex_wait(&grp->mutex, grp->arg);
+    grp->fn = fn;
+    grp->fn_arg = arg;
+
+    /* Fan-out work to all workers and wait for all of them to finish */
+    for (size_t idx = 0; idx < grp->workers_cnt; ++idx) {
+        lwow_sys_sem_release(&grp->workers[idx].sem_work, grp->arg);
+    }
+    for (size_t idx = 0; idx < grp->workers_cnt; ++idx) {
+        lwow_sys_sem_wait(&grp->sem_done, grp->arg);
+    }
+
+    /* Aggregate results */
+    for (size_t idx = 0; idx < grp->buses_cnt; ++idx) {
+        if (grp->status[idx] == lwowOK) {
+            ++cnt;
+        }
+        if (status != NULL) {
+            status[idx] = grp->status[idx];
+        }
+    }
+    SET_NOT_NULL(ok_cnt, cnt);
+    cnt = cnt == grp->buses_cnt;
+    lwow_sys_mutex_release(&grp->mutex, grp->arg);
+    return cnt ? lwowOK : lwowERR;
+}
+
+/**
+ * \brief           Execute transactions on all buses in parallel and wait for completion
+ * \param[in,out]   grp: Group handle
+ * \param[in,out]   txns: Array of transactions, one for every bus.
+ *                      Bus is skipped if its transaction has no steps
+ * \param[out]      status: Output array of at least `buses_cnt` elements to save result of every bus to.
+ *                      Set to `NULL` if not used
+ * \param[out]      ok_cnt: Output variable to save number of buses with successful result.
+ *                      Set to `NULL` if not used
+ * \return          \ref lwowOK if transactions succeeded on all buses, \ref lwowERR if any failed,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_group_execute_txn(lwow_group_t* const grp, lwow_txn_t* const txns, lwowr_t* const status,
+                       size_t* const ok_cnt) {
+    LWOW_ASSERT("grp != NULL", grp != NULL);
+    LWOW_ASSERT("txns != NULL", txns != NULL);
+
+    return lwow_group_execute(grp, prv_work_txn, txns, status, ok_cnt);
+}
+
+#endif /* LWOW_CFG_GROUP || __DOXYGEN__ */
@@ -0,0 +1,511 @@
+/**
+ * \file            lwow_registry.c
+ * \brief           Device registry implementation
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#include <stdint.h>
+#include <string.h>
+#include "lwow/lwow.h"
+#include "lwow/lwow_registry.h"
+
+#if LWOW_CFG_REGISTRY_MAX_DEVICES > 32767
+#error "LWOW_CFG_REGISTRY_MAX_DEVICES must not exceed 32767"
+#endif /* LWOW_CFG_REGISTRY_MAX_DEVICES > 32767 */
+
+#if !__DOXYGEN__
+
+/* Serialized format */
+#define REG_BLOB_MAGIC0  0x4CU /* 'L' */
+#define REG_BLOB_MAGIC1  0x57U /* 'W' */
+#define REG_BLOB_MAGIC2  0x52U /* 'R' */
+#define REG_BLOB_VERSION 0x01U
+
+#endif /* !__DOXYGEN__ */
+
+/* Set value if not NULL */
+#define SET_NOT_NULL(p, v)                                                                                             \
+    if ((p) != NULL) {                                                                                                 \
+        *(p) = (v);                                                                                                    \
+    }
+
+/**
+ * \brief           Convert ROM address to 64-bit key
+ * \param[in]       rom_id: ROM address
+ * \return          Key with first ROM byte being LSB
+ */
+static uint64_t
+prv_rom_to_key(const lwow_rom_t* const rom_id) {
+    uint64_t key = 0;
+
+    for (size_t i = sizeof(rom_id->rom); i > 0; --i) {
+        key = (key << 8U) | rom_id->rom[i - 1U];
+    }
+    return key;
+}
+
+/**
+ * \brief           Get home slot of the key in the hash index
+ * \param[in]       key: Device key
+ * \return          Slot number
+ */
+static size_t
+prv_key_slot(uint64_t key) {
+    key *= 0x9E3779B97F4A7C15ULL; /* Fibonacci hashing, mix all bits to upper part */
+    return (size_t)((key >> 32U) % LWOW_REGISTRY_INDEX_SIZE);
+}
+
+/**
+ * \brief           Find slot in hash index, that holds device with `key`
+ * \param[in]       reg: Registry handle
+ * \param[in]       key: Device key
+ * \param[out]      slot: Slot of the device, or first empty slot if device is not in the registry
+ * \return          `1` if device has been found, `0` otherwise
+ */
+static uint8_t
+prv_index_find(const lwow_registry_t* const reg, uint64_t key, size_t* slot) {
+    size_t s = prv_key_slot(key);
+
+    /* Index is never full, there is always empty slot to stop the probe */
+    while (reg->index[s] != 0) {
+        if (reg->key[reg->index[s] - 1U] == key) {
+            *slot = s;
+            return 1;
+        }
+        s = (s + 1U) % LWOW_REGISTRY_INDEX_SIZE;
+    }
+    *slot = s;
+    return 0;
+}
+
+/**
+ * \brief           Remove entry from hash index with backward shift of following entries
+ * \param[in,out]   reg: Registry handle
+ * \param[in]       slot: Slot to clear
+ */
+static void
+prv_index_remove(lwow_registry_t* const reg, size_t slot) {
+    size_t next = slot;
+
+    while (1) {
+        next = (next + 1U) % LWOW_REGISTRY_INDEX_SIZE;
+        if (reg->index[next] == 0) {
+            break;
+        }
+
+        /* Move entry to the free slot, unless free slot lies before its home slot */
+        size_t home = prv_key_slot(reg->key[reg->index[next] - 1U]);
+        if ((next > slot && (home <= slot || home > next)) || (next < slot && home <= slot && home > next)) {
+            reg->index[slot] = reg->index[next];
+            slot = next;
+        }
+    }
+    reg->index[slot] = 0;
+}
+
+/**
+ * \brief           Initialize (or clear) device registry
+ * \param[out]      reg: Registry handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_init(lwow_registry_t* const reg) {
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+
+    LWOW_MEMSET(reg, 0x00, sizeof(*reg));
+    return lwowOK;
+}
+
+/**
+ * \brief           Add device to the registry
+ *
+ * If device is already in the registry, its index is returned and data are not modified.
+ * New device has all flags and user slot cleared
+ *
+ * \param[in,out]   reg: Registry handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \param[out]      idx: Output variable to save device index to. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, \ref lwowERRMEM if registry is full,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_add(lwow_registry_t* const reg, const lwow_rom_t* const rom_id, size_t* const idx) {
+    uint64_t key;
+    size_t slot;
+
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    key = prv_rom_to_key(rom_id);
+    if (prv_index_find(reg, key, &slot)) {
+        if (idx != NULL) {
+            *idx = reg->index[slot] - 1U;
+        }
+        return lwowOK;
+    }
+    if (reg->count >= LWOW_CFG_REGISTRY_MAX_DEVICES) {
+        return lwowERRMEM;
+    }
+
+    /* Append device to the end of arrays */
+    reg->key[reg->count] = key;
+    reg->family[reg->count] = rom_id->rom[0];
+    reg->flags[reg->count] = 0;
+    reg->user[reg->count] = 0;
+    reg->index[slot] = (uint16_t)(reg->count + 1U);
+    if (idx != NULL) {
+        *idx = reg->count;
+    }
+    ++reg->count;
+    return lwowOK;
+}
+
+/**
+ * \brief           Find device in the registry
+ * \param[in]       reg: Registry handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \param[out]      idx: Output variable to save device index to. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, \ref lwowERRNODEV if device is not in the registry,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_find(const lwow_registry_t* const reg, const lwow_rom_t* const rom_id, size_t* const idx) {
+    size_t slot;
+
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    if (!prv_index_find(reg, prv_rom_to_key(rom_id), &slot)) {
+        return lwowERRNODEV;
+    }
+    if (idx != NULL) {
+        *idx = reg->index[slot] - 1U;
+    }
+    return lwowOK;
+}
+
+/**
+ * \brief           Remove device from the registry
+ *
+ * Last device in the registry is moved to the index of removed device,
+ * hence indexes, previously returned for the last device, are no longer valid
+ *
+ * \param[in,out]   reg: Registry handle
+ * \param[in]       rom_id: 1-Wire device address
+ * \return          \ref lwowOK on success, \ref lwowERRNODEV if device is not in the registry,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_remove(lwow_registry_t* const reg, const lwow_rom_t* const rom_id) {
+    size_t slot, idx, last;
+
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    if (!prv_index_find(reg, prv_rom_to_key(rom_id), &slot)) {
+        return lwowERRNODEV;
+    }
+    idx = reg->index[slot] - 1U;
+    prv_index_remove(reg, slot);
+
+    /* Move last device to the free place and update its index slot */
+    last = reg->count - 1U;
+    if (idx != last) {
+        prv_index_find(reg, reg->key[last], &slot);
+        reg->key[idx] = reg->key[last];
+        reg->family[idx] = reg->family[last];
+        reg->flags[idx] = reg->flags[last];
+        reg->user[idx] = reg->user[last];
+        reg->index[slot] = (uint16_t)(idx + 1U);
+    }
+    --reg->count;
+    return lwowOK;
+}
+
+/**
+ * \brief           Get ROM address of device at specific index
+ * \param[in]       reg: Registry handle
+ * \param[in]       idx: Device index, from `0` to `count - 1`
+ * \param[out]      rom_id: Pointer to ROM structure to store address
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_get_rom(const lwow_registry_t* const reg, const size_t idx, lwow_rom_t* const rom_id) {
+    uint64_t key;
+
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+    LWOW_ASSERT("idx < reg->count", idx < reg->count);
+    LWOW_ASSERT("rom_id != NULL", rom_id != NULL);
+
+    key = reg->key[idx];
+    for (size_t i = 0; i < sizeof(rom_id->rom); ++i, key >>= 8U) {
+        rom_id->rom[i] = (uint8_t)key;
+    }
+    return lwowOK;
+}
+
+/**
+ * \brief           Get number of devices in the registry
+ * \param[in]       reg: Registry handle
+ * \return          Number of devices
+ */
+size_t
+lwow_registry_get_count(const lwow_registry_t* const reg) {
+    LWOW_ASSERT0("reg != NULL", reg != NULL);
+
+    return reg->count;
+}
+
+/**
+ * \brief           Serialize registry to flat binary blob
+ *
+ * Blob starts with header, followed by one entry per device.
+ * Every entry holds ROM address, flags and user slot, protected with its own CRC-8.
+ * Multi-byte values are stored in little-endian format
+ *
+ * \param[in]       reg: Registry handle
+ * \param[out]      blob: Output memory, at least \ref LWOW_REGISTRY_BLOB_SIZE bytes long for all devices
+ * \param[in]       blob_len: Size of `blob` memory in units of bytes
+ * \param[out]      used: Output variable to save number of used bytes to. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, \ref lwowERRMEM if blob is too small,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_save(const lwow_registry_t* const reg, void* const blob, const size_t blob_len, size_t* const used) {
+    uint8_t* d = blob;
+
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+    LWOW_ASSERT("blob != NULL", blob != NULL);
+
+    if (blob_len < LWOW_REGISTRY_BLOB_SIZE(reg->count)) {
+        return lwowERRMEM;
+    }
+
+    /* Header */
+    d[0] = REG_BLOB_MAGIC0;
+    d[1] = REG_BLOB_MAGIC1;
+    d[2] = REG_BLOB_MAGIC2;
+    d[3] = REG_BLOB_VERSION;
+    d[4] = (uint8_t)reg->count;
+    d[5] = (uint8_t)(reg->count >> 8U);
+    d[6] = LWOW_REGISTRY_BLOB_ENTRY_SIZE;
+    d[7] = lwow_crc(d, LWOW_REGISTRY_BLOB_HDR_SIZE - 1U);
+    d += LWOW_REGISTRY_BLOB_HDR_SIZE;
+
+    /* Entries */
+    for (size_t idx = 0; idx < reg->count; ++idx, d += LWOW_REGISTRY_BLOB_ENTRY_SIZE) {
+        uint64_t key = reg->key[idx];
+        uint32_t user = reg->user[idx];
+
+        for (size_t i = 0; i < 8U; ++i, key >>= 8U) {
+            d[i] = (uint8_t)key;
+        }
+        d[8] = reg->flags[idx];
+        for (size_t i = 9U; i < 13U; ++i, user >>= 8U) {
+            d[i] = (uint8_t)user;
+        }
+        d[13] = lwow_crc(d, LWOW_REGISTRY_BLOB_ENTRY_SIZE - 1U);
+    }
+    SET_NOT_NULL(used, LWOW_REGISTRY_BLOB_SIZE(reg->count));
+    return lwowOK;
+}
+
+/**
+ * \brief           Restore registry from binary blob, created with \ref lwow_registry_save
+ *
+ * Registry is cleared first. Entries with invalid CRC are skipped.
+ * \ref LWOW_REGISTRY_FLAG_PRESENT flag is cleared for all devices,
+ * as presence is not known until devices are verified on the bus
+ *
+ * \param[out]      reg: Registry handle
+ * \param[in]       blob: Serialized registry
+ * \param[in]       blob_len: Size of `blob` in units of bytes
+ * \param[out]      skipped: Output variable to save number of invalid entries to. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, \ref lwowERRCRC if header is not valid,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_restore(lwow_registry_t* const reg, const void* const blob, const size_t blob_len,
+                      size_t* const skipped) {
+    const uint8_t* d = blob;
+    size_t cnt, skip = 0;
+    lwowr_t res = lwowOK;
+
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+    LWOW_ASSERT("blob != NULL", blob != NULL);
+
+    lwow_registry_init(reg);
+
+    /* Validate header */
+    if (blob_len < LWOW_REGISTRY_BLOB_HDR_SIZE || d[0] != REG_BLOB_MAGIC0 || d[1] != REG_BLOB_MAGIC1
+        || d[2] != REG_BLOB_MAGIC2 || d[3] != REG_BLOB_VERSION || d[6] != LWOW_REGISTRY_BLOB_ENTRY_SIZE
+        || lwow_crc(d, LWOW_REGISTRY_BLOB_HDR_SIZE) != 0) {
+        return lwowERRCRC;
+    }
+    cnt = (size_t)d[4] | ((size_t)d[5] << 8U);
+    if (blob_len < LWOW_REGISTRY_BLOB_SIZE(cnt)) {
+        return lwowERRCRC; /* Blob has been truncated */
+    }
+    d += LWOW_REGISTRY_BLOB_HDR_SIZE;
+
+    /* Entries, each checked separately */
+    for (; cnt > 0; --cnt, d += LWOW_REGISTRY_BLOB_ENTRY_SIZE) {
+        lwow_rom_t rom;
+        size_t idx;
+
+        LWOW_MEMCPY(rom.rom, d, sizeof(rom.rom));
+        if (lwow_crc(d, LWOW_REGISTRY_BLOB_ENTRY_SIZE) != 0 || lwow_crc(rom.rom, sizeof(rom.rom)) != 0) {
+            ++skip;
+            continue;
+        }
+        if ((res = lwow_registry_add(reg, &rom, &idx)) != lwowOK) {
+            break;
+        }
+        reg->flags[idx] = d[8] & (uint8_t)~LWOW_REGISTRY_FLAG_PRESENT;
+        reg->user[idx] = (uint32_t)d[9] | ((uint32_t)d[10] << 8U) | ((uint32_t)d[11] << 16U) | ((uint32_t)d[12] << 24U);
+    }
+    SET_NOT_NULL(skipped, skip);
+    return res;
+}
+
+/**
+ * \brief           Search for all devices on the bus and add them to the registry
+ *
+ * \ref LWOW_REGISTRY_FLAG_PRESENT flag is set for found devices and cleared for all others
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   reg: Registry handle
+ * \param[out]      added: Output variable to save number of newly added devices to. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, \ref lwowERRMEM if registry is full,
+ *                      member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_scan_raw(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const added) {
+    lwow_rom_t rom;
+    size_t idx, cnt = 0, new_cnt = 0;
+    lwowr_t res, res_add = lwowOK;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+
+    for (idx = 0; idx < reg->count; ++idx) {
+        reg->flags[idx] &= (uint8_t)~LWOW_REGISTRY_FLAG_PRESENT;
+    }
+    for (res = lwow_search_reset_raw(owobj); (res = lwow_search_raw(owobj, &rom)) == lwowOK;) {
+        cnt = reg->count;
+        if (lwow_registry_add(reg, &rom, &idx) == lwowOK) {
+            reg->flags[idx] |= LWOW_REGISTRY_FLAG_PRESENT;
+            new_cnt += reg->count - cnt;
+        } else {
+            res_add = lwowERRMEM; /* Continue with search to mark all known devices */
+        }
+    }
+    SET_NOT_NULL(added, new_cnt);
+    if (res == lwowERRNODEV || res == lwowERRPRESENCE) {
+        res = res_add; /* End of search or no devices on the bus */
+    }
+    return res;
+}
+
+/**
+ * \copydoc         lwow_registry_scan_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_registry_scan(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const added) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_registry_scan_raw(owobj, reg, added);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
+
+/**
+ * \brief           Verify presence of all devices in the registry
+ *
+ * Each device is verified with single targeted search pass, see \ref lwow_verify_rom_raw.
+ * \ref LWOW_REGISTRY_FLAG_PRESENT flag is updated for every device
+ *
+ * \param[in,out]   owobj: 1-Wire handle
+ * \param[in,out]   reg: Registry handle
+ * \param[out]      present_cnt: Output variable to save number of present devices. Set to `NULL` if not used
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_registry_verify_raw(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const present_cnt) {
+    lwow_rom_t rom;
+    size_t cnt = 0;
+    lwowr_t res = lwowOK;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+
+    for (size_t idx = 0; idx < reg->count; ++idx) {
+        reg->flags[idx] &= (uint8_t)~LWOW_REGISTRY_FLAG_PRESENT;
+        if (res != lwowOK) {
+            continue; /* Clear flag for remaining devices */
+        }
+        lwow_registry_get_rom(reg, idx, &rom);
+        res = lwow_verify_rom_raw(owobj, &rom);
+        if (res == lwowOK) {
+            reg->flags[idx] |= LWOW_REGISTRY_FLAG_PRESENT;
+            ++cnt;
+        } else if (res == lwowERRNODEV) {
+            res = lwowOK;
+        }
+    }
+    SET_NOT_NULL(present_cnt, cnt);
+    return res == lwowERRPRESENCE ? lwowOK : res;
+}
+
+/**
+ * \copydoc         lwow_registry_verify_raw
+ * \note            This function is thread-safe
+ */
+lwowr_t
+lwow_registry_verify(lwow_t* const owobj, lwow_registry_t* const reg, size_t* const present_cnt) {
+    lwowr_t res = lwowERR;
+
+    LWOW_ASSERT("owobj != NULL", owobj != NULL);
+    LWOW_ASSERT("reg != NULL", reg != NULL);
+
+    if ((res = lwow_protect(owobj, 1U)) != lwowOK) {
+        return res;
+    }
+    res = lwow_registry_verify_raw(owobj, reg, present_cnt);
+    lwow_unprotect(owobj, 1U);
+    return res;
+}
@@ -0,0 +1,603 @@
+/**
+ * \file            lwow_reactor_epoll.c
+ * \brief           Single-threaded epoll reactor for serial 1-Wire buses
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE /* cfmakeraw, CBAUD and clock_gettime with strict C standard */
+#endif                  /* _DEFAULT_SOURCE */
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "system/lwow_reactor_epoll.h"
+
+#if !__DOXYGEN__
+
+/**
+ * \brief           Get monotonic time in units of milliseconds
+ * \return          Current time
+ */
+static int64_t
+prv_time_ms(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static uint8_t
+prv_ll_init(void* arg) {
+    LWOW_UNUSED(arg);
+    return 1;
+}
+
+static uint8_t
+prv_ll_deinit(void* arg) {
+    LWOW_UNUSED(arg);
+    return 1;
+}
+
+/* Baudrates with dedicated termios speed constant */
+static const struct {
+    uint32_t baud;
+    speed_t speed;
+} prv_speeds[] = {
+    {1200, B1200},       {2400, B2400},       {4800, B4800},       {9600, B9600},     {19200, B19200},
+    {38400, B38400},     {57600, B57600},     {115200, B115200},   {230400, B230400},
+#ifdef B460800
+    {460800, B460800},
+#endif /* B460800 */
+#ifdef B500000
+    {500000, B500000},
+#endif /* B500000 */
+#ifdef B576000
+    {576000, B576000},
+#endif /* B576000 */
+#ifdef B921600
+    {921600, B921600},
+#endif /* B921600 */
+#ifdef B1000000
+    {1000000, B1000000},
+#endif /* B1000000 */
+#ifdef B1152000
+    {1152000, B1152000},
+#endif /* B1152000 */
+#ifdef B1500000
+    {1500000, B1500000},
+#endif /* B1500000 */
+#ifdef B2000000
+    {2000000, B2000000},
+#endif /* B2000000 */
+#ifdef B2500000
+    {2500000, B2500000},
+#endif /* B2500000 */
+#ifdef B3000000
+    {3000000, B3000000},
+#endif /* B3000000 */
+#ifdef B3500000
+    {3500000, B3500000},
+#endif /* B3500000 */
+#ifdef B4000000
+    {4000000, B4000000},
+#endif /* B4000000 */
+};
+
+/*
+ * Kernel interface for arbitrary baudrates, such as default \ref LWOW_CFG_OD_BAUD_RESET.
+ * Structure layout is the same on all architectures listed below
+ */
+#if defined(TCGETS2) && defined(CBAUD) && defined(CIBAUD)                                                              \
+    && (defined(__x86_64__) || defined(__i386__) || defined(__arm__) || defined(__aarch64__) || defined(__riscv))
+#define PRV_CUSTOM_BAUD 1
+
+struct termios2 {
+    tcflag_t c_iflag;
+    tcflag_t c_oflag;
+    tcflag_t c_cflag;
+    tcflag_t c_lflag;
+    cc_t c_line;
+    cc_t c_cc[19];
+    speed_t c_ispeed;
+    speed_t c_ospeed;
+};
+
+#ifndef BOTHER
+#define BOTHER 0010000
+#endif /* BOTHER */
+#else
+#define PRV_CUSTOM_BAUD 0
+#endif
+
+static uint8_t
+prv_ll_set_baudrate(uint32_t baud, void* arg) {
+    lwow_reactor_bus_t* bus = arg;
+    struct termios tio;
+
+    for (size_t idx = 0; idx < LWOW_ARRAYSIZE(prv_speeds); ++idx) {
+        if (prv_speeds[idx].baud == baud) {
+            if (tcgetattr(bus->fd, &tio) != 0 || cfsetispeed(&tio, prv_speeds[idx].speed) != 0
+                || cfsetospeed(&tio, prv_speeds[idx].speed) != 0) {
+                return 0;
+            }
+            return tcsetattr(bus->fd, TCSANOW, &tio) == 0;
+        }
+    }
+#if PRV_CUSTOM_BAUD
+    {
+        struct termios2 tio2;
+
+        /* Input speed bits are cleared, input uses the same baudrate as output */
+        if (ioctl(bus->fd, TCGETS2, &tio2) != 0) {
+            return 0;
+        }
+        tio2.c_cflag = (tio2.c_cflag & ~(tcflag_t)(CBAUD | CIBAUD)) | BOTHER;
+        tio2.c_ispeed = baud;
+        tio2.c_ospeed = baud;
+        return ioctl(bus->fd, TCSETS2, &tio2) == 0;
+    }
+#else
+    return 0; /* Baudrate not supported */
+#endif /* PRV_CUSTOM_BAUD */
+}
+
+/*
+ * Blocking exchange, used by regular API when no transaction is pending
+ */
+static uint8_t
+prv_ll_tx_rx(const uint8_t* tx, uint8_t* rx, size_t len, void* arg) {
+    lwow_reactor_bus_t* bus = arg;
+    struct pollfd pfd = {.fd = bus->fd, .events = POLLIN};
+    size_t cnt = 0;
+    ssize_t res;
+
+    if (bus->hangup) {
+        return 0;
+    }
+    tcflush(bus->fd, TCIFLUSH);
+    while (cnt < len) {
+        if ((res = write(bus->fd, &tx[cnt], len - cnt)) > 0) {
+            cnt += (size_t)res;
+        } else if (res < 0 && errno != EAGAIN && errno != EINTR) {
+            return 0;
+        } else {
+            pfd.events = POLLOUT;
+            poll(&pfd, 1, (int)bus->reactor->timeout);
+        }
+    }
+    pfd.events = POLLIN;
+    for (cnt = 0; cnt < len;) {
+        if ((res = read(bus->fd, &rx[cnt], len - cnt)) > 0) {
+            cnt += (size_t)res;
+        } else if (res == 0 || (errno != EAGAIN && errno != EINTR)) {
+            return 0; /* Port closed or error */
+        } else if (poll(&pfd, 1, (int)bus->reactor->timeout) <= 0) {
+            return 0; /* Timeout */
+        }
+    }
+    return 1;
+}
+
+/* Low-level driver for serial port, argument is bus handle */
+static const lwow_ll_drv_t prv_ll_drv = {
+    .init = prv_ll_init,
+    .deinit = prv_ll_deinit,
+    .set_baudrate = prv_ll_set_baudrate,
+    .tx_rx = prv_ll_tx_rx,
+};
+
+/**
+ * \brief           Update events bus is waiting for
+ * \param[in]       bus: Bus handle
+ * \param[in]       out: Set to `1` to wait also for port to become writable
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+prv_bus_watch(lwow_reactor_bus_t* const bus, const uint8_t out) {
+    struct epoll_event ev = {.events = EPOLLIN | (out ? EPOLLOUT : 0), .data.ptr = bus};
+
+    return epoll_ctl(bus->reactor->epfd, EPOLL_CTL_MOD, bus->fd, &ev) == 0;
+}
+
+/**
+ * \brief           Finish pending transaction of the bus and notify application
+ * \param[in]       bus: Bus handle
+ * \param[in]       res: Transaction result
+ */
+static void
+prv_bus_finish(lwow_reactor_bus_t* const bus, const lwowr_t res) {
+    lwow_txn_t* txn = bus->txn;
+
+    bus->txn = NULL;
+    bus->ow.async_txn = NULL; /* Instance is available to regular API again */
+    --bus->reactor->pending;
+    if (bus->done_fn != NULL) {
+        bus->done_fn(bus, txn, res, bus->done_arg);
+    }
+}
+
+/**
+ * \brief           Stop watching port, that has been hung up or reported an error
+ *
+ * Level-triggered `EPOLLHUP` would otherwise wake up the reactor forever
+ *
+ * \param[in]       bus: Bus handle
+ */
+static void
+prv_bus_hangup(lwow_reactor_bus_t* const bus) {
+    bus->hangup = 1;
+    epoll_ctl(bus->reactor->epfd, EPOLL_CTL_DEL, bus->fd, NULL);
+    if (bus->txn != NULL) {
+        prv_bus_finish(bus, lwowERRTXRX);
+    }
+}
+
+/**
+ * \brief           Write as many bytes of current exchange as port accepts
+ * \param[in]       bus: Bus handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+static lwowr_t
+prv_bus_write(lwow_reactor_bus_t* const bus) {
+    ssize_t res;
+
+    while (bus->tx_cnt < bus->len) {
+        if ((res = write(bus->fd, &bus->trx[bus->tx_cnt], bus->len - bus->tx_cnt)) > 0) {
+            bus->tx_cnt += (size_t)res;
+        } else if (res < 0 && errno == EINTR) {
+            continue;
+        } else if (res < 0 && errno == EAGAIN) {
+            return prv_bus_watch(bus, 1) ? lwowOK : lwowERRTXRX;
+        } else {
+            return lwowERRTXRX;
+        }
+    }
+    return prv_bus_watch(bus, 0) ? lwowOK : lwowERRTXRX;
+}
+
+/**
+ * \brief           Advance transaction of the bus and start next exchange
+ * \param[in]       bus: Bus handle
+ * \param[in]       res: Result of previous step
+ */
+static void
+prv_bus_advance(lwow_reactor_bus_t* const bus, lwowr_t res) {
+    if (res == lwowOK && (res = lwow_txn_prepare_raw(&bus->ow, bus->txn, bus->trx, &bus->len)) == lwowOK
+        && bus->len > 0) {
+        bus->tx_cnt = 0;
+        bus->rx_cnt = 0;
+        bus->deadline = prv_time_ms() + bus->reactor->timeout;
+        if ((res = prv_bus_write(bus)) == lwowOK) {
+            return; /* Wait for the echo */
+        }
+    }
+    prv_bus_finish(bus, res);
+}
+
+/**
+ * \brief           Process readable port of the bus
+ * \param[in]       bus: Bus handle
+ */
+static void
+prv_bus_read(lwow_reactor_bus_t* const bus) {
+    uint8_t tmp[32];
+    ssize_t res;
+
+    if (bus->txn == NULL) {
+        while (read(bus->fd, tmp, sizeof(tmp)) > 0) {} /* Discard unexpected data */
+        return;
+    }
+    while (bus->rx_cnt < bus->len) {
+        if ((res = read(bus->fd, &bus->trx[bus->rx_cnt], bus->len - bus->rx_cnt)) > 0) {
+            bus->rx_cnt += (size_t)res;
+        } else if (res < 0 && errno == EINTR) {
+            continue;
+        } else if (res < 0 && errno == EAGAIN) {
+            return; /* Wait for more data */
+        } else {
+            prv_bus_finish(bus, lwowERRTXRX);
+            return;
+        }
+    }
+    prv_bus_advance(bus, lwow_txn_complete_raw(&bus->ow, bus->txn, bus->trx, bus->len));
+}
+
+#endif /* !__DOXYGEN__ */
+
+/**
+ * \brief           Initialize reactor
+ * \param[out]      r: Reactor handle
+ * \param[in]       timeout: Timeout of single exchange in units of milliseconds
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reactor_init(lwow_reactor_t* const r, const uint32_t timeout) {
+    LWOW_ASSERT("r != NULL", r != NULL);
+    LWOW_ASSERT("timeout > 0", timeout > 0);
+
+    LWOW_MEMSET(r, 0x00, sizeof(*r));
+    r->timeout = timeout;
+    if ((r->epfd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        return lwowERR;
+    }
+    return lwowOK;
+}
+
+/**
+ * \brief           De-initialize reactor
+ * \note            All buses must be removed before
+ * \param[in,out]   r: Reactor handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reactor_deinit(lwow_reactor_t* const r) {
+    LWOW_ASSERT("r != NULL", r != NULL);
+
+    close(r->epfd);
+    r->epfd = -1;
+    return lwowOK;
+}
+
+/**
+ * \brief           Add serial port to the reactor and initialize 1-Wire instance on it
+ *
+ * Port is configured to raw 8N1 mode and switched to non-blocking operation.
+ * Pseudo-terminal may be used instead of real serial port for testing.
+ *
+ * \param[in,out]   r: Reactor handle
+ * \param[out]      bus: Bus handle to initialize
+ * \param[in]       fd: Opened serial port file descriptor
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reactor_add_bus(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus, const int fd) {
+    struct epoll_event ev = {.events = EPOLLIN, .data.ptr = bus};
+    struct termios tio;
+    lwowr_t res;
+    int flags;
+
+    LWOW_ASSERT("r != NULL", r != NULL);
+    LWOW_ASSERT("bus != NULL", bus != NULL);
+    LWOW_ASSERT("fd >= 0", fd >= 0);
+
+    LWOW_MEMSET(bus, 0x00, sizeof(*bus));
+    bus->fd = fd;
+    bus->reactor = r;
+
+    /* Raw mode, 8 data bits, no parity, 1 stop bit */
+    if (tcgetattr(fd, &tio) != 0) {
+        return lwowERRPAR;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | PARENB | CRTSCTS);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    if (tcsetattr(fd, TCSANOW, &tio) != 0 || (flags = fcntl(fd, F_GETFL)) < 0
+        || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+        return lwowERRPAR;
+    }
+    if ((res = lwow_init(&bus->ow, &prv_ll_drv, bus)) != lwowOK) {
+        return res;
+    }
+    if (epoll_ctl(r->epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        lwow_deinit(&bus->ow);
+        return lwowERR;
+    }
+    bus->next = r->buses;
+    r->buses = bus;
+    return lwowOK;
+}
+
+/**
+ * \brief           Open serial port and add it to the reactor
+ * \note            Port is not closed by \ref lwow_reactor_remove_bus, application must close `bus->fd`
+ * \param[in,out]   r: Reactor handle
+ * \param[out]      bus: Bus handle to initialize
+ * \param[in]       path: Serial port device path, such as `/dev/ttyUSB0`
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reactor_open_bus(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus, const char* const path) {
+    lwowr_t res;
+    int fd;
+
+    LWOW_ASSERT("path != NULL", path != NULL);
+
+    if ((fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC)) < 0) {
+        return lwowERRPAR;
+    }
+    if ((res = lwow_reactor_add_bus(r, bus, fd)) != lwowOK) {
+        close(fd);
+    }
+    return res;
+}
+
+/**
+ * \brief           Remove bus from the reactor and de-initialize its 1-Wire instance
+ *
+ * Pending transaction is finished with \ref lwowERR result.
+ * Function may be called from transaction finished callback,
+ * events of the bus, still waiting in current \ref lwow_reactor_run call, are dropped
+ *
+ * \param[in,out]   r: Reactor handle
+ * \param[in,out]   bus: Bus handle
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reactor_remove_bus(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus) {
+    LWOW_ASSERT("r != NULL", r != NULL);
+    LWOW_ASSERT("bus != NULL", bus != NULL);
+
+    if (bus->txn != NULL) {
+        prv_bus_finish(bus, lwowERR);
+    }
+    if (!bus->hangup) {
+        epoll_ctl(r->epfd, EPOLL_CTL_DEL, bus->fd, NULL);
+    }
+    for (size_t idx = 0; idx < r->evs_cnt; ++idx) {
+        if (r->evs[idx].data.ptr == bus) {
+            r->evs[idx].data.ptr = NULL; /* Bus may be freed once function returns */
+        }
+    }
+    for (lwow_reactor_bus_t** b = &r->buses; *b != NULL; b = &(*b)->next) {
+        if (*b == bus) {
+            *b = bus->next;
+            break;
+        }
+    }
+    lwow_deinit(&bus->ow);
+    return lwowOK;
+}
+
+/**
+ * \brief           Start transaction on the bus
+ *
+ * Function returns immediately, transaction is executed by \ref lwow_reactor_run
+ * and `done_fn` is called once it finishes.
+ * Until then, 1-Wire instance of the bus is busy and its thread-safe functions return \ref lwowERRBUSY
+ *
+ * \param[in,out]   r: Reactor handle
+ * \param[in,out]   bus: Bus handle
+ * \param[in,out]   txn: Transaction to execute. It must stay valid until it finishes
+ * \param[in]       done_fn: Transaction finished callback. Set to `NULL` if not used
+ * \param[in]       done_arg: Custom argument passed to callback function
+ * \return          \ref lwowOK on success, \ref lwowERRBUSY if bus has pending transaction,
+ *                      \ref lwowERRTXRX if port has been hung up, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reactor_submit(lwow_reactor_t* const r, lwow_reactor_bus_t* const bus, lwow_txn_t* const txn,
+                    lwow_reactor_done_fn done_fn, void* done_arg) {
+    lwowr_t res;
+
+    LWOW_ASSERT("r != NULL", r != NULL);
+    LWOW_ASSERT("bus != NULL", bus != NULL);
+    LWOW_ASSERT("txn != NULL", txn != NULL);
+
+    if (bus->hangup) {
+        return lwowERRTXRX;
+    }
+
+    /* Mark instance busy, regular API must not exchange bytes until transaction finishes */
+    if ((res = lwow_protect(&bus->ow, 1U)) != lwowOK) {
+        return res;
+    }
+    bus->ow.async_txn = txn;
+    lwow_unprotect(&bus->ow, 1U);
+
+    bus->txn = txn;
+    bus->done_fn = done_fn;
+    bus->done_arg = done_arg;
+    ++r->pending;
+    tcflush(bus->fd, TCIFLUSH);
+    prv_bus_advance(bus, lwow_txn_start_raw(&bus->ow, txn));
+    return lwowOK;
+}
+
+/**
+ * \brief           Wait for port events and advance pending transactions
+ *
+ * Function returns after events have been processed or when timeout expires.
+ * Transactions, waiting for their exchange longer than reactor timeout, are finished with \ref lwowERRTXRX.
+ * Port, that has been hung up or reported an error, is removed from epoll set
+ * and its pending transaction is finished with \ref lwowERRTXRX.
+ * Application shall remove such bus with \ref lwow_reactor_remove_bus and reopen the port
+ *
+ * \param[in,out]   r: Reactor handle
+ * \param[in]       timeout: Maximum time to wait for events in units of milliseconds,
+ *                      `0` to only process already available events or `-1` to wait forever
+ * \param[out]      pending: Output variable to save number of still pending transactions.
+ *                      Set to `NULL` if not used
+ * \return          \ref lwowOK on success, member of \ref lwowr_t otherwise
+ */
+lwowr_t
+lwow_reactor_run(lwow_reactor_t* const r, const int timeout, size_t* const pending) {
+    struct epoll_event evs[16];
+    int cnt, tout = timeout;
+    int64_t now;
+
+    LWOW_ASSERT("r != NULL", r != NULL);
+
+    if (r->pending > 0 && (tout < 0 || (uint32_t)tout > r->timeout)) {
+        tout = (int)r->timeout; /* Wake up to check exchange timeouts */
+    }
+    if ((cnt = epoll_wait(r->epfd, evs, (int)LWOW_ARRAYSIZE(evs), tout)) < 0) {
+        if (errno != EINTR) {
+            return lwowERR;
+        }
+        cnt = 0;
+    }
+
+    /* Callbacks may remove buses, their entries are then cleared by remove function */
+    r->evs = evs;
+    r->evs_cnt = (size_t)cnt;
+    for (int idx = 0; idx < cnt; ++idx) {
+        lwow_reactor_bus_t* bus = evs[idx].data.ptr;
+
+        if (bus != NULL && bus->txn != NULL && (evs[idx].events & EPOLLOUT)) {
+            lwowr_t res = prv_bus_write(bus);
+            if (res != lwowOK) {
+                prv_bus_finish(bus, res);
+                continue;
+            }
+        }
+        if (evs[idx].data.ptr != NULL && (evs[idx].events & EPOLLIN)) {
+            prv_bus_read(bus);
+        }
+        if (evs[idx].data.ptr != NULL && (evs[idx].events & (EPOLLERR | EPOLLHUP))) {
+            prv_bus_hangup(bus);
+        }
+    }
+    r->evs = NULL;
+    r->evs_cnt = 0;
+
+    /* Finish transactions with no response from the port, list is rescanned as callback may modify it */
+    if (r->pending > 0) {
+        now = prv_time_ms();
+        for (lwow_reactor_bus_t* bus = r->buses; bus != NULL;) {
+            if (bus->txn != NULL && now >= bus->deadline) {
+                prv_bus_finish(bus, lwowERRTXRX);
+                bus = r->buses;
+            } else {
+                bus = bus->next;
+            }
+        }
+    }
+    if (pending != NULL) {
+        *pending = r->pending;
+    }
+    return lwowOK;
+}
@@ -65,4 +65,63 @@ lwow_sys_mutex_release(LWOW_CFG_OS_MUTEX_HANDLE* m, void* arg) {
     return osMutexRelease(*m) == osOK;
 }
 
+#if LWOW_CFG_GROUP
+
+uint8_t
+lwow_sys_sem_create(LWOW_CFG_OS_SEM_HANDLE* sem, uint8_t cnt, void* arg) {
+    LWOW_UNUSED(arg);
+    const osSemaphoreAttr_t attr = {
+        .name = "lwow_sem",
+    };
+    return (*sem = osSemaphoreNew(0xFFFF, cnt, &attr)) != NULL;
+}
+
+uint8_t
+lwow_sys_sem_delete(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return osSemaphoreDelete(*sem) == osOK;
+}
+
+uint8_t
+lwow_sys_sem_wait(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return osSemaphoreAcquire(*sem, osWaitForever) == osOK;
+}
+
+uint8_t
+lwow_sys_sem_release(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return osSemaphoreRelease(*sem) == osOK;
+}
+
+/*
+ * Thread function returns when group is de-initialized,
+ * CMSIS-RTOS2 kernel terminates the thread with implicit osThreadExit call
+ */
+uint8_t
+lwow_sys_thread_create(lwow_sys_thread_fn thread_fn, void* thread_arg, void* arg) {
+    LWOW_UNUSED(arg);
+    const osThreadAttr_t attr = {
+        .name = "lwow_group",
+        .stack_size = LWOW_CFG_GROUP_THREAD_STACK_SIZE,
+        .priority = osPriorityNormal,
+    };
+    return osThreadNew(thread_fn, thread_arg, &attr) != NULL;
+}
+
+#endif /* LWOW_CFG_GROUP */
+
+#if LWOW_CFG_DS18X20_POLL_DELAY
+
+uint8_t
+lwow_sys_delay(uint32_t ms, void* arg) {
+    uint32_t ticks;
+
+    LWOW_UNUSED(arg);
+    ticks = (uint32_t)(((uint64_t)ms * osKernelGetTickFreq() + 999U) / 1000U);
+    return osDelay(ticks > 0 ? ticks : 1) == osOK;
+}
+
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY */
+
 #endif /* LWOW_CFG_OS && !__DOXYGEN__ */
@@ -0,0 +1,165 @@
+/**
+ * \file            lwow_sys_posix.c
+ * \brief           System functions for POSIX
+ */
+
+/*
+ * Copyright (c) 2024 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of LwOW - Lightweight onewire library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         v3.0.2
+ */
+#include "system/lwow_sys.h"
+
+#if LWOW_CFG_OS && !__DOXYGEN__
+
+/*
+ * To use this module, options must be defined as
+ *
+ * #include <pthread.h>
+ * #include <semaphore.h>
+ * #define LWOW_CFG_OS_MUTEX_HANDLE     pthread_mutex_t
+ * #define LWOW_CFG_OS_SEM_HANDLE       sem_t
+ */
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+
+uint8_t
+lwow_sys_mutex_create(LWOW_CFG_OS_MUTEX_HANDLE* mutex, void* arg) {
+    pthread_mutexattr_t attr;
+    uint8_t res;
+
+    LWOW_UNUSED(arg);
+    if (pthread_mutexattr_init(&attr) != 0) {
+        return 0;
+    }
+    res = pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE) == 0 && pthread_mutex_init(mutex, &attr) == 0;
+    pthread_mutexattr_destroy(&attr);
+    return res;
+}
+
+uint8_t
+lwow_sys_mutex_delete(LWOW_CFG_OS_MUTEX_HANDLE* mutex, void* arg) {
+    LWOW_UNUSED(arg);
+    return pthread_mutex_destroy(mutex) == 0;
+}
+
+uint8_t
+lwow_sys_mutex_wait(LWOW_CFG_OS_MUTEX_HANDLE* mutex, void* arg) {
+    LWOW_UNUSED(arg);
+    return pthread_mutex_lock(mutex) == 0;
+}
+
+uint8_t
+lwow_sys_mutex_release(LWOW_CFG_OS_MUTEX_HANDLE* mutex, void* arg) {
+    LWOW_UNUSED(arg);
+    return pthread_mutex_unlock(mutex) == 0;
+}
+
+#if LWOW_CFG_GROUP
+
+/* Thread start context */
+typedef struct {
+    lwow_sys_thread_fn fn;
+    void* arg;
+} lwow_sys_thread_ctx_t;
+
+uint8_t
+lwow_sys_sem_create(LWOW_CFG_OS_SEM_HANDLE* sem, uint8_t cnt, void* arg) {
+    LWOW_UNUSED(arg);
+    return sem_init(sem, 0, cnt) == 0;
+}
+
+uint8_t
+lwow_sys_sem_delete(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return sem_destroy(sem) == 0;
+}
+
+uint8_t
+lwow_sys_sem_wait(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    int res;
+
+    LWOW_UNUSED(arg);
+    while ((res = sem_wait(sem)) != 0 && errno == EINTR) {}
+    return res == 0;
+}
+
+uint8_t
+lwow_sys_sem_release(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return sem_post(sem) == 0;
+}
+
+static void*
+prv_thread_start(void* thread_arg) {
+    lwow_sys_thread_ctx_t ctx = *(lwow_sys_thread_ctx_t*)thread_arg;
+
+    free(thread_arg);
+    ctx.fn(ctx.arg);
+    return NULL;
+}
+
+uint8_t
+lwow_sys_thread_create(lwow_sys_thread_fn thread_fn, void* thread_arg, void* arg) {
+    lwow_sys_thread_ctx_t* ctx;
+    pthread_t thread;
+
+    LWOW_UNUSED(arg);
+    if ((ctx = malloc(sizeof(*ctx))) == NULL) {
+        return 0;
+    }
+    ctx->fn = thread_fn;
+    ctx->arg = thread_arg;
+    if (pthread_create(&thread, NULL, prv_thread_start, ctx) != 0) {
+        free(ctx);
+        return 0;
+    }
+    pthread_detach(thread);
+    return 1;
+}
+
+#endif /* LWOW_CFG_GROUP */
+
+#if LWOW_CFG_DS18X20_POLL_DELAY
+
+uint8_t
+lwow_sys_delay(uint32_t ms, void* arg) {
+    struct timespec ts;
+
+    LWOW_UNUSED(arg);
+    ts.tv_sec = ms / 1000U;
+    ts.tv_nsec = (long)(ms % 1000U) * 1000000L;
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {}
+    return 1;
+}
+
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY */
+
+#endif /* LWOW_CFG_OS && !__DOXYGEN__ */
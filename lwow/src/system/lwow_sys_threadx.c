@@ -39,6 +39,7 @@
  * To use this module, options must be defined as
  *
  * #define LWOW_CFG_OS_MUTEX_HANDLE     TX_MUTEX
+ * #define LWOW_CFG_OS_SEM_HANDLE       TX_SEMAPHORE
  */
 
 /* Include ThreadX API module */
@@ -70,4 +71,105 @@ lwow_sys_mutex_release(LWOW_CFG_OS_MUTEX_HANDLE* m, void* arg) {
     return tx_mutex_put(m) == TX_SUCCESS;
 }
 
+#if LWOW_CFG_GROUP
+
+#include "system/lwow_sys.h"
+#include "tx_semaphore.h"
+
+/* Priority of group worker threads */
+#ifndef LWOW_SYS_THREADX_GROUP_PRIO
+#define LWOW_SYS_THREADX_GROUP_PRIO 10
+#endif
+
+/* Maximum number of groups, existing at the same time */
+#ifndef LWOW_SYS_THREADX_GROUP_CNT
+#define LWOW_SYS_THREADX_GROUP_CNT 1
+#endif
+
+/*
+ * Static thread pool, shared by all groups, completed threads are deleted and reused.
+ * Every group takes up to LWOW_CFG_GROUP_MAX_WORKERS threads from the pool, until it is de-initialized
+ */
+static struct {
+    TX_THREAD thread;
+    uint8_t created;
+    lwow_sys_thread_fn fn;
+    void* arg;
+    ULONG stack[LWOW_CFG_GROUP_THREAD_STACK_SIZE / sizeof(ULONG)];
+} threads[LWOW_CFG_GROUP_MAX_WORKERS * LWOW_SYS_THREADX_GROUP_CNT];
+
+uint8_t
+lwow_sys_sem_create(LWOW_CFG_OS_SEM_HANDLE* sem, uint8_t cnt, void* arg) {
+    static char name[] = "lwow_sem";
+    LWOW_UNUSED(arg);
+    return tx_semaphore_create(sem, name, cnt) == TX_SUCCESS;
+}
+
+uint8_t
+lwow_sys_sem_delete(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return tx_semaphore_delete(sem) == TX_SUCCESS;
+}
+
+uint8_t
+lwow_sys_sem_wait(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return tx_semaphore_get(sem, TX_WAIT_FOREVER) == TX_SUCCESS;
+}
+
+uint8_t
+lwow_sys_sem_release(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return tx_semaphore_put(sem) == TX_SUCCESS;
+}
+
+static void
+prv_thread_entry(ULONG input) {
+    threads[input].fn(threads[input].arg);
+}
+
+uint8_t
+lwow_sys_thread_create(lwow_sys_thread_fn thread_fn, void* thread_arg, void* arg) {
+    static char name[] = "lwow_group";
+    UINT state;
+
+    LWOW_UNUSED(arg);
+    for (ULONG idx = 0; idx < LWOW_ARRAYSIZE(threads); ++idx) {
+        TX_THREAD* t = &threads[idx].thread;
+
+        if (threads[idx].created) {
+            if (tx_thread_info_get(t, NULL, &state, NULL, NULL, NULL, NULL, NULL, NULL) != TX_SUCCESS
+                || (state != TX_COMPLETED && state != TX_TERMINATED) || tx_thread_delete(t) != TX_SUCCESS) {
+                continue;
+            }
+            threads[idx].created = 0;
+        }
+        threads[idx].fn = thread_fn;
+        threads[idx].arg = thread_arg;
+        if (tx_thread_create(t, name, prv_thread_entry, idx, threads[idx].stack, sizeof(threads[idx].stack),
+                             LWOW_SYS_THREADX_GROUP_PRIO, LWOW_SYS_THREADX_GROUP_PRIO, TX_NO_TIME_SLICE, TX_AUTO_START)
+            != TX_SUCCESS) {
+            return 0;
+        }
+        threads[idx].created = 1;
+        return 1;
+    }
+    return 0; /* Pool exhausted, increase LWOW_SYS_THREADX_GROUP_CNT */
+}
+
+#endif /* LWOW_CFG_GROUP */
+
+#if LWOW_CFG_DS18X20_POLL_DELAY
+
+uint8_t
+lwow_sys_delay(uint32_t ms, void* arg) {
+    ULONG ticks;
+
+    LWOW_UNUSED(arg);
+    ticks = (ULONG)(((uint64_t)ms * TX_TIMER_TICKS_PER_SECOND + 999U) / 1000U);
+    return tx_thread_sleep(ticks > 0 ? ticks : 1) == TX_SUCCESS;
+}
+
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY */
+
 #endif /* LWOW_CFG_OS && !__DOXYGEN__ */
@@ -32,6 +32,7 @@
  * Version:         v3.0.2
  */
 #include "system/lwow_sys.h"
+#include <stdlib.h>
 #include "windows.h"
 
 #if LWOW_CFG_OS && !__DOXYGEN__
@@ -63,4 +64,79 @@ lwow_sys_mutex_release(LWOW_CFG_OS_MUTEX_HANDLE* mutex, void* arg) {
     return ReleaseMutex(*mutex);
 }
 
+#if LWOW_CFG_GROUP
+
+/* Thread start context */
+typedef struct {
+    lwow_sys_thread_fn fn;
+    void* arg;
+} lwow_sys_thread_ctx_t;
+
+uint8_t
+lwow_sys_sem_create(LWOW_CFG_OS_SEM_HANDLE* sem, uint8_t cnt, void* arg) {
+    LWOW_UNUSED(arg);
+    return (*sem = CreateSemaphore(NULL, cnt, LONG_MAX, NULL)) != NULL;
+}
+
+uint8_t
+lwow_sys_sem_delete(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    CloseHandle(*sem);
+    *sem = NULL;
+    return 1;
+}
+
+uint8_t
+lwow_sys_sem_wait(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return WaitForSingleObject(*sem, INFINITE) == WAIT_OBJECT_0;
+}
+
+uint8_t
+lwow_sys_sem_release(LWOW_CFG_OS_SEM_HANDLE* sem, void* arg) {
+    LWOW_UNUSED(arg);
+    return ReleaseSemaphore(*sem, 1, NULL);
+}
+
+static DWORD WINAPI
+prv_thread_start(LPVOID thread_arg) {
+    lwow_sys_thread_ctx_t ctx = *(lwow_sys_thread_ctx_t*)thread_arg;
+
+    free(thread_arg);
+    ctx.fn(ctx.arg);
+    return 0;
+}
+
+uint8_t
+lwow_sys_thread_create(lwow_sys_thread_fn thread_fn, void* thread_arg, void* arg) {
+    lwow_sys_thread_ctx_t* ctx;
+    HANDLE thread;
+
+    LWOW_UNUSED(arg);
+    if ((ctx = malloc(sizeof(*ctx))) == NULL) {
+        return 0;
+    }
+    ctx->fn = thread_fn;
+    ctx->arg = thread_arg;
+    if ((thread = CreateThread(NULL, 0, prv_thread_start, ctx, 0, NULL)) == NULL) {
+        free(ctx);
+        return 0;
+    }
+    CloseHandle(thread);
+    return 1;
+}
+
+#endif /* LWOW_CFG_GROUP */
+
+#if LWOW_CFG_DS18X20_POLL_DELAY
+
+uint8_t
+lwow_sys_delay(uint32_t ms, void* arg) {
+    LWOW_UNUSED(arg);
+    Sleep(ms);
+    return 1;
+}
+
+#endif /* LWOW_CFG_DS18X20_POLL_DELAY */
+
 #endif /* LWOW_CFG_OS && !__DOXYGEN__ */